@@ -0,0 +1,367 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <atomic>
+#include <emmintrin.h>
+
+#include "AntiAlias.h"
+
+#include "ParallelRender.h"
+
+#include "MarianiSilver.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+struct MAntiAliasJob
+{
+	const MFrame*        frame;
+	const MRenderParams* params;
+
+	//       (CalcPointsSSE/AVX2).
+	MKernel              kernel;
+	size_t               grid;
+
+	double               minX;
+	double               maxY;
+	double               xMapStep;
+	double               yMapStep;
+
+	//       .
+	std::atomic<size_t>  edgePixels;
+
+	// -   :      .
+	std::atomic<bool>    failed;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static bool IsEdgePixel(const MFrame* frame, const size_t x, const size_t y);
+
+static size_t FindEdgePixels(const MFrame* frame, const MTile* tile, size_t* edges);
+
+static uint32_t HashSample(const size_t x, const size_t y, const size_t sample);
+
+static void SupersampleTileFunc(void* context, const MTile* tile);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief   :       
+ *            8 .    ,   .
+*/
+static bool IsEdgePixel(const MFrame* frame, const size_t x, const size_t y)
+{
+	assert(frame);
+	assert(frame->iterNums);
+
+	const uint32_t* iterNums = frame->iterNums;
+	const uint32_t  iterNum  = iterNums[y * frame->stride + x];
+
+	const size_t x0 = x > 0 ? x - 1 : x;
+	const size_t y0 = y > 0 ? y - 1 : y;
+	const size_t x1 = x + 1 < frame->width  ? x + 1 : x;
+	const size_t y1 = y + 1 < frame->height ? y + 1 : y;
+
+	for (size_t ny = y0; ny <= y1; ny++)
+	{
+		for (size_t nx = x0; nx <= x1; nx++)
+		{
+			if (iterNums[ny * frame->stride + nx] != iterNum)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief      (IsEdgePixel) -     
+ *        (y * stride + x).    
+ *        4      : 8  
+ *         ,        ,   
+ *           .
+ *
+ * @return   .
+*/
+static size_t FindEdgePixels(const MFrame* frame, const MTile* tile, size_t* edges)
+{
+	assert(frame);
+	assert(frame->iterNums);
+	assert(tile);
+	assert(edges);
+
+	const size_t width     = frame->width;
+	const size_t stride    = frame->stride;
+	size_t       edgeCount = 0;
+
+	for (size_t y = tile->y0; y < tile->y0 + tile->height; y++)
+	{
+		const uint32_t* row = frame->iterNums + y * stride;
+
+		size_t x = tile->x0;
+
+		if (y > 0 && y + 1 < frame->height)
+		{
+			if (x == 0)
+			{
+				if (IsEdgePixel(frame, x, y))
+					edges[edgeCount++] = y * stride + x;
+
+				x++;
+			}
+
+			for (; x + 4 < width && x + 4 <= tile->x0 + tile->width; x += 4)
+			{
+				const __m128i center = _mm_loadu_si128((const __m128i*)(row + x));
+
+				__m128i same = _mm_set1_epi32(-1);
+
+				for (long long dy = -1; dy <= 1; dy++)
+				{
+					const uint32_t* neighbors = row + dy * (long long)stride + x;
+
+					same = _mm_and_si128(same, _mm_cmpeq_epi32(center, _mm_loadu_si128((const __m128i*)(neighbors - 1))));
+					same = _mm_and_si128(same, _mm_cmpeq_epi32(center, _mm_loadu_si128((const __m128i*)(neighbors + 1))));
+
+					if (dy != 0)
+						same = _mm_and_si128(same, _mm_cmpeq_epi32(center, _mm_loadu_si128((const __m128i*)neighbors)));
+				}
+
+				const int differ = ~_mm_movemask_ps(_mm_castsi128_ps(same)) & 0xF;
+
+				for (size_t lane = 0; lane < 4; lane++)
+				{
+					if (differ & (1 << lane))
+						edges[edgeCount++] = y * stride + x + lane;
+				}
+			}
+		}
+
+		for (; x < tile->x0 + tile->width; x++)
+		{
+			if (IsEdgePixel(frame, x, y))
+				edges[edgeCount++] = y * stride + x;
+		}
+	}
+
+	return edgeCount;
+}
+
+/**
+ * @brief  32    sample  (x, y).   
+ *         ,     ,   
+ *              .
+*/
+static inline uint32_t HashSample(const size_t x, const size_t y, const size_t sample)
+{
+	uint32_t hash = (uint32_t)x * 0x9E3779B1u ^ (uint32_t)y * 0x85EBCA77u ^ (uint32_t)sample * 0xC2B2AE3Du;
+
+	hash ^= hash >> 16;
+	hash *= 0x7FEB352Du;
+	hash ^= hash >> 15;
+	hash *= 0x846CA68Bu;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+/**
+ * @brief    :     grid x grid ,
+ *          ,       ,  
+ *          ,    -    .       
+ *         ,        .
+ *             ,    ,
+ *              .
+*/
+static void SupersampleTileFunc(void* context, const MTile* tile)
+{
+	assert(context);
+	assert(tile);
+
+	MAntiAliasJob* job   = (MAntiAliasJob*)context;
+	const MFrame*  frame = job->frame;
+
+	//    -   ,   .
+	const size_t samples   = job->grid * job->grid - 1;
+	const size_t maxPixels = tile->width * tile->height;
+
+	size_t* edges = (size_t*)malloc(maxPixels * sizeof(size_t));
+
+	if (!edges)
+	{
+		job->failed = true;
+		return;
+	}
+
+	const size_t edgeCount = FindEdgePixels(frame, tile, edges);
+
+	const size_t pointCount = edgeCount * samples;
+
+	double*   pointsX = (double*)  malloc(pointCount * sizeof(double));
+	double*   pointsY = (double*)  malloc(pointCount * sizeof(double));
+	uint32_t* iters   = (uint32_t*)malloc(pointCount * sizeof(uint32_t));
+	RGBQUAD*  colors  = (RGBQUAD*) malloc(pointCount * sizeof(RGBQUAD));
+
+	if (edgeCount > 0 && !(pointsX && pointsY && iters && colors))
+		job->failed = true;
+	else if (edgeCount > 0)
+	{
+		const size_t grid = job->grid;
+		const double cell = 1.0 / (double)grid;
+
+		for (size_t edge = 0; edge < edgeCount; edge++)
+		{
+			const size_t x = edges[edge] % frame->stride;
+			const size_t y = edges[edge] / frame->stride;
+
+			//    i -  minX + i * xMapStep,      [i - 1/2, i + 1/2),
+			//    -  .     :   grid   ,
+			//   -   ,   .
+			const uint32_t center  = HashSample(x, y, grid * grid);
+			const size_t   centerX = grid % 2 ? grid / 2 : grid / 2 - 1 + (center & 1);
+			const size_t   centerY = grid % 2 ? grid / 2 : grid / 2 - 1 + (center >> 1 & 1);
+
+			size_t sample = 0;
+
+			for (size_t cellIndex = 0; cellIndex < grid * grid; cellIndex++)
+			{
+				const size_t cellX = cellIndex % grid;
+				const size_t cellY = cellIndex / grid;
+
+				if (cellX == centerX && cellY == centerY)
+					continue;
+
+				const uint32_t hash = HashSample(x, y, cellIndex);
+
+				const double offsetX = ((double)cellX + (hash & 0xFFFF) / 65536.0) * cell - 0.5;
+				const double offsetY = ((double)cellY + (hash >> 16)    / 65536.0) * cell - 0.5;
+
+				pointsX[edge * samples + sample] = job->minX + ((double)x + offsetX) * job->xMapStep;
+				pointsY[edge * samples + sample] = job->maxY - ((double)y + offsetY) * job->yMapStep;
+				sample++;
+			}
+		}
+
+		if (job->kernel == MKERNEL_AVX2)
+			CalcPointsAVX2(pointsX, pointsY, pointCount, job->params, iters);
+		else
+			CalcPointsSSE(pointsX, pointsY, pointCount, job->params, iters);
+
+		ColorizeIterations(iters, nullptr, colors, pointCount);
+
+		for (size_t edge = 0; edge < edgeCount; edge++)
+		{
+			const RGBQUAD* pixelColors = colors + edge * samples;
+			const RGBQUAD  base        = frame->pixels[edges[edge]];
+
+			size_t blue  = base.rgbBlue  + (samples + 1) / 2;
+			size_t green = base.rgbGreen + (samples + 1) / 2;
+			size_t red   = base.rgbRed   + (samples + 1) / 2;
+
+			for (size_t sample = 0; sample < samples; sample++)
+			{
+				blue  += pixelColors[sample].rgbBlue;
+				green += pixelColors[sample].rgbGreen;
+				red   += pixelColors[sample].rgbRed;
+			}
+
+			RGBQUAD* pixel = &frame->pixels[edges[edge]];
+
+			*pixel = RGBQUAD {};
+
+			pixel->rgbBlue  = (BYTE)(blue  / (samples + 1));
+			pixel->rgbGreen = (BYTE)(green / (samples + 1));
+			pixel->rgbRed   = (BYTE)(red   / (samples + 1));
+		}
+
+		job->edgePixels += edgeCount;
+	}
+
+	free(edges);
+	free(pointsX);
+	free(pointsY);
+	free(iters);
+	free(colors);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief  :     ,  ,
+ *              (IsEdgePixel), 
+ *         grid x grid      .  
+ *           ,      
+ *         grid^2   ,       .
+ *              :  (ColorizeFrame)
+ *         .
+ *
+ * @param tileSize    ,    .
+ * @param grid         ,  2  MAX_ANTIALIAS_GRID.
+ * @param edgePixels   ;   nullptr.
+ *
+ * @return false,       ( ,  
+ *              ,        double)
+ *                  .
+*/
+bool RenderMandelbrotAntiAliased(MThreadPool* pool, const MFrame* frame, const MRect* map,
+								 const MRenderParams* params, const size_t tileSize, const size_t grid,
+								 size_t* edgePixels)
+{
+	assert(pool);
+	assert(frame);
+	assert(frame->pixels);
+	assert(map);
+	assert(params);
+
+	if (grid < 2 || grid > MAX_ANTIALIAS_GRID || params->smoothColoring || IsDistanceKernel(params->kernel) ||
+		params->fractal != MFRACTAL_MANDELBROT || !IsDoublePrecisionEnough(frame, map))
+		return false;
+
+	//     ,      .
+	MFrame    target   = *frame;
+	uint32_t* iterNums = nullptr;
+
+	if (!target.iterNums)
+	{
+		iterNums = (uint32_t*)malloc(frame->stride * frame->height * sizeof(uint32_t));
+
+		if (!iterNums)
+			return false;
+
+		target.iterNums = iterNums;
+	}
+
+	if (!RenderMandelbrotParallel(pool, &target, map, params, tileSize))
+	{
+		free(iterNums);
+		return false;
+	}
+
+	MAntiAliasJob job;
+
+	job.frame      = &target;
+	job.params     = params;
+	job.kernel     = GetSubdivisionKernel(params->kernel);
+	job.grid       = grid;
+	job.minX       = map->minX;
+	job.maxY       = map->maxY;
+	job.xMapStep   = (map->maxX - map->minX) / frame->width;
+	job.yMapStep   = (map->maxY - map->minY) / frame->height;
+	job.edgePixels = 0;
+	job.failed     = false;
+
+	RenderTilesParallel(pool, &target, tileSize, SupersampleTileFunc, &job);
+
+	if (edgePixels)
+		*edgePixels = job.edgePixels;
+
+	free(iterNums);
+
+	return !job.failed;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
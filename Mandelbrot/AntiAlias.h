@@ -0,0 +1,16 @@
+#ifndef ANTI_ALIAS_H_
+#define ANTI_ALIAS_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//      : 2 -  ,     4   .
+const size_t DEFAULT_ANTIALIAS_GRID = 2;
+const size_t MAX_ANTIALIAS_GRID     = 4;
+
+bool RenderMandelbrotAntiAliased(MThreadPool* pool, const MFrame* frame, const MRect* map,
+								 const MRenderParams* params, const size_t tileSize, const size_t grid,
+								 size_t* edgePixels);
+
+#endif
\ No newline at end of file
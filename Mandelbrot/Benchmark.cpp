@@ -0,0 +1,306 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+#include "Benchmark.h"
+
+#include "KernelStats.h"
+#include "ParallelRender.h"
+#include "Perturbation.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+struct MBenchmarkView
+{
+	const char* name;
+
+	MRect       map;
+
+	//        ; deepX == nullptr -  .
+	const char* deepX;
+	const char* deepY;
+	double      deepWidth;
+
+	size_t      maxIterations;
+};
+
+//       ,       .
+static const MBenchmarkView BENCHMARK_VIEWS[] =
+{
+	//  :     .
+	{ "full",     { -2, 1, -1, 1 },                      nullptr, nullptr, 0, DEFAULT_MAX_ITERATIONS },
+
+	//   :   ,      .
+	{ "seahorse", { -0.8, -0.7, 0.05, 0.1166666 },       nullptr, nullptr, 0, 1000 },
+
+	//   :     ,   .
+	{ "interior", { -0.6, -0.4, -0.0666666, 0.0666666 }, nullptr, nullptr, 0, 500 },
+
+	//  1e-10: double    ,     .
+	{ "deep",     { 0, 0, 0, 0 },
+	  "-0.743643887037158704752191506114774", "0.131825904205311970493132056385139", 1e-10, 3000 }
+};
+
+static const MKernel BENCHMARK_KERNELS[] =
+{
+	MKERNEL_SIMPLE,
+	MKERNEL_SSE,
+	MKERNEL_FLOAT_SSE,
+	MKERNEL_FLOAT_SSE_REFILL,
+	MKERNEL_AVX2,
+	MKERNEL_AVX512,
+	MKERNEL_DD_SSE,
+	MKERNEL_DD_AVX2,
+	MKERNEL_DE_SSE,
+	MKERNEL_DE_AVX2
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static int CompareSeconds(const void* a, const void* b);
+
+static bool RenderBenchmarkFrame(MThreadPool* pool, const MFrame* frame, const MBenchmarkView* view,
+								 const MRenderParams* params);
+
+static bool RunBenchmarkCase(MThreadPool* pool, const MFrame* frame, const MBenchmarkView* view, const MKernel kernel,
+							 const size_t runs, double* seconds, MBenchmarkResult* result);
+
+static void PrintBenchmarkResult(const MBenchmarkResult* result);
+
+static bool WriteBenchmarkJson(const char* fileName, const MBenchmarkResult* results, const size_t resultCount,
+							   const size_t threads, const size_t runs);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static int CompareSeconds(const void* a, const void* b)
+{
+	const double first  = *(const double*)a;
+	const double second = *(const double*)b;
+
+	return (first > second) - (first < second);
+}
+
+static bool RenderBenchmarkFrame(MThreadPool* pool, const MFrame* frame, const MBenchmarkView* view,
+								 const MRenderParams* params)
+{
+	assert(view);
+
+	if (view->deepX)
+	{
+		const MDeepView deep = { view->deepX, view->deepY, view->deepWidth,
+								 view->deepWidth * frame->height / frame->width };
+
+		return RenderDeepMandelbrotParallel(pool, frame, &deep, params, DEFAULT_TILE_SIZE);
+	}
+
+	return RenderMandelbrotParallel(pool, frame, &view->map, params, DEFAULT_TILE_SIZE);
+}
+
+/**
+ * @brief    view     ( ,  )
+ *         runs     .
+ *
+ * @param seconds   runs .
+*/
+static bool RunBenchmarkCase(MThreadPool* pool, const MFrame* frame, const MBenchmarkView* view, const MKernel kernel,
+							 const size_t runs, double* seconds, MBenchmarkResult* result)
+{
+	assert(frame);
+	assert(view);
+	assert(runs > 0);
+	assert(seconds);
+	assert(result);
+
+	//      :   ,      .
+	//   "deep"  :          ,
+	//     ,      .
+	MRenderParams params = {};
+
+	params.kernel              = kernel;
+	params.maxIterations       = view->maxIterations;
+	params.bailout             = DEFAULT_BAILOUT;
+	params.seriesApproximation = false;
+	params.fractal             = MFRACTAL_MANDELBROT;
+
+	MFrame target = *frame;
+
+	if (!IsDistanceKernel(kernel))
+		target.distances = nullptr;
+
+	if (!RenderBenchmarkFrame(pool, &target, view, &params))
+		return false;
+
+	for (size_t st = 0; st < runs; st++)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		RenderBenchmarkFrame(pool, &target, view, &params);
+
+		seconds[st] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	unsigned long long iterations = 0;
+
+	for (size_t y = 0; y < frame->height; y++)
+	{
+		for (size_t x = 0; x < frame->width; x++)
+			iterations += frame->iterNums[y * frame->stride + x];
+	}
+
+	qsort(seconds, runs, sizeof(double), CompareSeconds);
+
+	// p99 -   :  100      .
+	const size_t p99Rank = (runs * 99 + 99) / 100;
+
+	*result = MBenchmarkResult { view->name, view->deepX ? GetPerturbationKernel(kernel) : kernel, view->deepX != nullptr,
+								 view->maxIterations, runs, seconds[runs / 2], seconds[p99Rank - 1], seconds[0],
+								 iterations };
+
+	if (runs % 2 == 0)
+		result->medianSeconds = (seconds[runs / 2 - 1] + seconds[runs / 2]) / 2;
+
+	return true;
+}
+
+static void PrintBenchmarkResult(const MBenchmarkResult* result)
+{
+	assert(result);
+
+	const double pixels = (double)BENCHMARK_WIDTH * BENCHMARK_HEIGHT;
+
+	printf("%-9s %-14s %10.3lf %10.3lf %10.3lf %9.2lf %8.3lf\n", result->view, GetKernelName(result->kernel),
+		   result->medianSeconds * 1000, result->p99Seconds * 1000, result->minSeconds * 1000,
+		   result->medianSeconds * 1e9 / pixels, result->iterations / result->medianSeconds / 1e9);
+}
+
+static bool WriteBenchmarkJson(const char* fileName, const MBenchmarkResult* results, const size_t resultCount,
+							   const size_t threads, const size_t runs)
+{
+	assert(fileName);
+	assert(results);
+
+	FILE* file = fopen(fileName, "w");
+
+	if (!file)
+	{
+		printf("Cannot open \"%s\" for writing.\n", fileName);
+		return false;
+	}
+
+	fprintf(file, "{\n  \"width\": %zu,\n  \"height\": %zu,\n  \"threads\": %zu,\n  \"runs\": %zu,\n  \"results\": [\n",
+			BENCHMARK_WIDTH, BENCHMARK_HEIGHT, threads, runs);
+
+	const double pixels = (double)BENCHMARK_WIDTH * BENCHMARK_HEIGHT;
+
+	for (size_t st = 0; st < resultCount; st++)
+	{
+		const MBenchmarkResult* result = &results[st];
+
+		fprintf(file, "    { \"view\": \"%s\", \"kernel\": \"%s\", \"perturbation\": %s, \"max_iterations\": %zu, "
+					  "\"median_ms\": %.4lf, \"p99_ms\": %.4lf, \"min_ms\": %.4lf, \"ns_per_pixel\": %.3lf, "
+					  "\"iterations\": %llu, \"iterations_per_second\": %.6g }%s\n",
+				result->view, GetKernelName(result->kernel), result->perturbation ? "true" : "false",
+				result->maxIterations, result->medianSeconds * 1000, result->p99Seconds * 1000,
+				result->minSeconds * 1000, result->medianSeconds * 1e9 / pixels, result->iterations,
+				result->iterations / result->medianSeconds, st + 1 < resultCount ? "," : "");
+	}
+
+	fprintf(file, "  ]\n}\n");
+
+	bool written = !ferror(file);
+
+	written = fclose(file) == 0 && written;
+
+	if (!written)
+		printf("Failed to write \"%s\".\n", fileName);
+
+	return written;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief   ,   ,    
+ *        (BENCHMARK_VIEWS)   BENCHMARK_WIDTH x BENCHMARK_HEIGHT   , p99
+ *           runs ,        ( ).
+ *         "deep"      ,      sse  avx2.
+ *
+ * @param jsonName     JSON;   nullptr.
+ *
+ * @return false,         JSON.
+*/
+bool RunBenchmarkSuite(MThreadPool* pool, const size_t runs, const char* jsonName)
+{
+	assert(pool);
+	assert(runs > 0);
+
+	MFrame frame = {};
+
+	const bool allocated = FrameCreate(&frame, BENCHMARK_WIDTH, BENCHMARK_HEIGHT, true, true, true);
+	double*    seconds   = (double*)malloc(runs * sizeof(double));
+
+	const size_t viewCount   = sizeof(BENCHMARK_VIEWS)   / sizeof(BENCHMARK_VIEWS[0]);
+	const size_t kernelCount = sizeof(BENCHMARK_KERNELS) / sizeof(BENCHMARK_KERNELS[0]);
+
+	MBenchmarkResult* results = (MBenchmarkResult*)malloc(viewCount * kernelCount * sizeof(MBenchmarkResult));
+
+	if (!allocated || !seconds || !results)
+	{
+		puts("Not enough memory for the benchmark.");
+		FrameDestroy(&frame);
+		free(seconds);
+		free(results);
+		return false;
+	}
+
+	printf("Benchmark: %zux%zu, %zu thread(s), %zu run(s) per case%s\n", BENCHMARK_WIDTH, BENCHMARK_HEIGHT,
+		   ThreadPoolGetThreadCount(pool), runs, KERNEL_STATS_ENABLED ? " (kernel counters on: times are slower)" : "");
+	printf("%-9s %-14s %10s %10s %10s %9s %8s\n", "view", "kernel", "median ms", "p99 ms", "min ms", "ns/pixel",
+		   "Giter/s");
+
+	size_t resultCount = 0;
+
+	for (size_t view = 0; view < viewCount; view++)
+	{
+		for (size_t kernel = 0; kernel < kernelCount; kernel++)
+		{
+			const MBenchmarkView* benchmarkView   = &BENCHMARK_VIEWS[view];
+			const MKernel         benchmarkKernel = BENCHMARK_KERNELS[kernel];
+
+			if (!IsKernelSupported(benchmarkKernel) ||
+				(benchmarkView->deepX && benchmarkKernel != MKERNEL_SSE && benchmarkKernel != MKERNEL_AVX2))
+				continue;
+
+			KernelStatsReset();
+
+			if (!RunBenchmarkCase(pool, &frame, benchmarkView, benchmarkKernel, runs, seconds, &results[resultCount]))
+			{
+				printf("%-9s %-14s cannot be rendered\n", benchmarkView->name, GetKernelName(benchmarkKernel));
+				continue;
+			}
+
+			PrintBenchmarkResult(&results[resultCount++]);
+
+			//        ,    ,    .
+			if (KERNEL_STATS_ENABLED)
+				KernelStatsPrint();
+		}
+	}
+
+	bool written = !jsonName ||
+				   WriteBenchmarkJson(jsonName, results, resultCount, ThreadPoolGetThreadCount(pool), runs);
+
+	FrameDestroy(&frame);
+	free(seconds);
+	free(results);
+
+	return written;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//   :        ,
+//    ,   .  ,     double-double
+//       .
+const size_t BENCHMARK_WIDTH  = 576;
+const size_t BENCHMARK_HEIGHT = 384;
+
+struct MBenchmarkResult
+{
+	const char*        view;
+
+	MKernel            kernel;
+	bool               perturbation;
+
+	size_t             maxIterations;
+	size_t             runs;
+
+	double             medianSeconds;
+	double             p99Seconds;
+	double             minSeconds;
+
+	//     .
+	unsigned long long iterations;
+};
+
+bool RunBenchmarkSuite(MThreadPool* pool, const size_t runs, const char* jsonName);
+
+#endif
\ No newline at end of file
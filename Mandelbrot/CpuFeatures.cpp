@@ -0,0 +1,101 @@
+#include "CpuFeatures.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static void Cpuid(const unsigned leaf, const unsigned subleaf, unsigned regs[4]);
+
+static unsigned long long ReadXCR0();
+
+static MCpuFeatures DetectCpuFeatures();
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static void Cpuid(const unsigned leaf, const unsigned subleaf, unsigned regs[4])
+{
+#ifdef _MSC_VER
+	int info[4] = {};
+	__cpuidex(info, (int)leaf, (int)subleaf);
+
+	for (size_t st = 0; st < 4; st++)
+		regs[st] = (unsigned)info[st];
+#else
+	regs[0] = regs[1] = regs[2] = regs[3] = 0;
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static unsigned long long ReadXCR0()
+{
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	unsigned eax = 0;
+	unsigned edx = 0;
+
+	__asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+	return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+
+/**
+ * @brief       .
+ *          CPUID   XCR0:   ymm/zmm  
+ *            AVX .
+*/
+static MCpuFeatures DetectCpuFeatures()
+{
+	MCpuFeatures features = {};
+
+	unsigned regs[4] = {};
+
+	Cpuid(0, 0, regs);
+	const unsigned maxLeaf = regs[0];
+
+	if (maxLeaf < 7)
+		return features;
+
+	Cpuid(1, 0, regs);
+
+	const bool osxsave = (regs[2] >> 27) & 1;
+	const bool avx     = (regs[2] >> 28) & 1;
+	const bool fma     = (regs[2] >> 12) & 1;
+
+	if (!osxsave || !avx)
+		return features;
+
+	const unsigned long long xcr0 = ReadXCR0();
+
+	// SSE  AVX (ymm) .
+	if ((xcr0 & 0x6) != 0x6)
+		return features;
+
+	Cpuid(7, 0, regs);
+
+	features.fma  = fma;
+	features.avx2 = (regs[1] >> 5) & 1;
+
+	// opmask,   zmm0-15  zmm16-31.
+	if ((xcr0 & 0xE0) == 0xE0)
+		features.avx512f = (regs[1] >> 16) & 1;
+
+	return features;
+}
+
+const MCpuFeatures* GetCpuFeatures()
+{
+	static const MCpuFeatures features = DetectCpuFeatures();
+
+	return &features;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
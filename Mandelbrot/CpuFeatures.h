@@ -0,0 +1,28 @@
+#ifndef CPU_FEATURES_H_
+#define CPU_FEATURES_H_
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2   __attribute__((target("avx,avx2,fma")))
+#define TARGET_AVX512 __attribute__((target("avx,avx2,fma,avx512f")))
+
+//    (FractalKernel.h): ,   ,   
+//      .
+#define TARGET_AVX2_FLATTEN   __attribute__((target("avx,avx2,fma"), flatten))
+#define TARGET_AVX512_FLATTEN __attribute__((target("avx,avx2,fma,avx512f"), flatten))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX512
+#define TARGET_AVX2_FLATTEN
+#define TARGET_AVX512_FLATTEN
+#endif
+
+struct MCpuFeatures
+{
+	bool avx2;
+	bool fma;
+	bool avx512f;
+};
+
+const MCpuFeatures* GetCpuFeatures();
+
+#endif
\ No newline at end of file
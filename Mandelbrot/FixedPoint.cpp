@@ -0,0 +1,280 @@
+#include <assert.h>
+#include <ctype.h>
+#include <math.h>
+
+#include "FixedPoint.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static int CompareMagnitude(const MFixed* a, const MFixed* b);
+
+static void AddMagnitude(MFixed* dest, const MFixed* a, const MFixed* b);
+
+static void SubMagnitude(MFixed* dest, const MFixed* a, const MFixed* b);
+
+static void AddSigned(MFixed* dest, const MFixed* a, const MFixed* b, const bool negateB);
+
+static uint32_t DivideBySmall(MFixed* value, const uint32_t divisor);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static int CompareMagnitude(const MFixed* a, const MFixed* b)
+{
+	assert(a);
+	assert(b);
+	assert(a->limbCount == b->limbCount);
+
+	for (size_t st = a->limbCount; st-- > 0; )
+	{
+		if (a->limbs[st] != b->limbs[st])
+			return a->limbs[st] < b->limbs[st] ? -1 : 1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief |dest| = |a| + |b|.     :   .
+*/
+static void AddMagnitude(MFixed* dest, const MFixed* a, const MFixed* b)
+{
+	assert(dest);
+	assert(a);
+	assert(b);
+
+	uint64_t carry = 0;
+
+	for (size_t st = 0; st < a->limbCount; st++)
+	{
+		uint64_t sum = (uint64_t)a->limbs[st] + b->limbs[st] + carry;
+
+		dest->limbs[st] = (uint32_t)sum;
+		carry           = sum >> 32;
+	}
+}
+
+/**
+ * @brief |dest| = |a| - |b|, |a| >= |b|.
+*/
+static void SubMagnitude(MFixed* dest, const MFixed* a, const MFixed* b)
+{
+	assert(dest);
+	assert(a);
+	assert(b);
+
+	uint64_t borrow = 0;
+
+	for (size_t st = 0; st < a->limbCount; st++)
+	{
+		uint64_t diff = (uint64_t)a->limbs[st] - b->limbs[st] - borrow;
+
+		dest->limbs[st] = (uint32_t)diff;
+		borrow          = (diff >> 32) & 1;
+	}
+}
+
+static void AddSigned(MFixed* dest, const MFixed* a, const MFixed* b, const bool negateB)
+{
+	assert(dest);
+	assert(a);
+	assert(b);
+	assert(a->limbCount == b->limbCount);
+
+	const bool negativeB = b->negative != negateB;
+
+	dest->limbCount = a->limbCount;
+
+	if (a->negative == negativeB)
+	{
+		dest->negative = a->negative;
+		AddMagnitude(dest, a, b);
+		return;
+	}
+
+	//  :      .
+	if (CompareMagnitude(a, b) >= 0)
+	{
+		dest->negative = a->negative;
+		SubMagnitude(dest, a, b);
+	}
+	else
+	{
+		dest->negative = negativeB;
+		SubMagnitude(dest, b, a);
+	}
+}
+
+/**
+ * @brief      .
+ *
+ * @return .
+*/
+static uint32_t DivideBySmall(MFixed* value, const uint32_t divisor)
+{
+	assert(value);
+	assert(divisor);
+
+	uint64_t remainder = 0;
+
+	for (size_t st = value->limbCount; st-- > 0; )
+	{
+		uint64_t cur = (remainder << 32) | value->limbs[st];
+
+		value->limbs[st] = (uint32_t)(cur / divisor);
+		remainder        = cur % divisor;
+	}
+
+	return (uint32_t)remainder;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+void FixedSetZero(MFixed* dest, const size_t limbCount)
+{
+	assert(dest);
+	assert(limbCount >= 2 && limbCount <= FIXED_MAX_LIMBS);
+
+	dest->negative  = false;
+	dest->limbCount = limbCount;
+
+	for (size_t st = 0; st < FIXED_MAX_LIMBS; st++)
+		dest->limbs[st] = 0;
+}
+
+/**
+ * @brief     [-]123.456   :
+ *           atof,       .
+ *
+ * @return false,            32 .
+*/
+bool FixedFromString(MFixed* dest, const char* str, const size_t limbCount)
+{
+	assert(dest);
+	assert(str);
+
+	FixedSetZero(dest, limbCount);
+
+	const char* cur = str;
+
+	if (*cur == '-' || *cur == '+')
+		dest->negative = *cur++ == '-';
+
+	uint64_t integer = 0;
+	bool     digits  = false;
+
+	for (; isdigit((unsigned char)*cur); cur++)
+	{
+		integer = integer * 10 + (uint64_t)(*cur - '0');
+		digits  = true;
+
+		if (integer > UINT32_MAX)
+			return false;
+	}
+
+	const char* fraction = cur;
+	const char* end      = cur;
+
+	if (*cur == '.')
+	{
+		fraction = ++cur;
+
+		for (; isdigit((unsigned char)*cur); cur++)
+			digits = true;
+
+		end = cur;
+	}
+
+	if (!digits || *cur != '\0')
+		return false;
+
+	//-----------------------------------------------------------------------
+	//      : value = (value + digit) / 10.
+	//     ,      .
+	//-----------------------------------------------------------------------
+
+	for (const char* digit = end; digit-- > fraction; )
+	{
+		dest->limbs[limbCount - 1] = (uint32_t)(*digit - '0');
+		DivideBySmall(dest, 10);
+	}
+
+	dest->limbs[limbCount - 1] = (uint32_t)integer;
+
+	return true;
+}
+
+double FixedToDouble(const MFixed* value)
+{
+	assert(value);
+
+	const size_t top = value->limbCount - 1;
+
+	//      53  .
+	double result = value->limbs[top];
+	double weight = 1;
+
+	for (size_t st = 1; st <= 2 && st <= top; st++)
+	{
+		weight /= 4294967296.0;
+		result += value->limbs[top - st] * weight;
+	}
+
+	return value->negative ? -result : result;
+}
+
+void FixedAdd(MFixed* dest, const MFixed* a, const MFixed* b)
+{
+	AddSigned(dest, a, b, false);
+}
+
+void FixedSub(MFixed* dest, const MFixed* a, const MFixed* b)
+{
+	AddSigned(dest, a, b, true);
+}
+
+/**
+ * @brief dest = a * b.    (2n )  
+ *         n - 1  ;     .
+ *        dest    a  b.
+*/
+void FixedMul(MFixed* dest, const MFixed* a, const MFixed* b)
+{
+	assert(dest);
+	assert(a);
+	assert(b);
+	assert(a->limbCount == b->limbCount);
+
+	const size_t limbCount = a->limbCount;
+
+	uint32_t product[2 * FIXED_MAX_LIMBS] = {};
+
+	for (size_t i = 0; i < limbCount; i++)
+	{
+		if (a->limbs[i] == 0)
+			continue;
+
+		uint64_t carry = 0;
+
+		for (size_t j = 0; j < limbCount; j++)
+		{
+			uint64_t cur = (uint64_t)a->limbs[i] * b->limbs[j] + product[i + j] + carry;
+
+			product[i + j] = (uint32_t)cur;
+			carry          = cur >> 32;
+		}
+
+		product[i + limbCount] = (uint32_t)carry;
+	}
+
+	dest->negative  = a->negative != b->negative;
+	dest->limbCount = limbCount;
+
+	for (size_t st = 0; st < limbCount; st++)
+		dest->limbs[st] = product[st + limbCount - 1];
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef FIXED_POINT_H_
+#define FIXED_POINT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 32      1056   (  1e-317).
+const size_t FIXED_MAX_LIMBS = 34;
+
+struct MFixed
+{
+	bool     negative;
+
+	//   , limbs[limbCount - 1] -  .
+	size_t   limbCount;
+	uint32_t limbs[FIXED_MAX_LIMBS];
+};
+
+void FixedSetZero(MFixed* dest, const size_t limbCount);
+
+bool FixedFromString(MFixed* dest, const char* str, const size_t limbCount);
+
+double FixedToDouble(const MFixed* value);
+
+void FixedAdd(MFixed* dest, const MFixed* a, const MFixed* b);
+
+void FixedSub(MFixed* dest, const MFixed* a, const MFixed* b);
+
+void FixedMul(MFixed* dest, const MFixed* a, const MFixed* b);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,689 @@
+#ifndef FRACTAL_KERNEL_H_
+#define FRACTAL_KERNEL_H_
+
+#include <assert.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include "MandelbrotRender.h"
+
+#include "CpuFeatures.h"
+
+#include "KernelStats.h"
+
+//-----------------------------------------------------------------------
+//   :   RenderFormulaTile   ,
+//   (Formula)    (Ops)   .
+// Ops -    intrinsics,     ,
+//    (, Ops)       .
+//
+//  AVX2  AVX-512     ,    MAVX2Ops
+//  MAVX512Ops     TARGET_AVX2_FLATTEN / TARGET_AVX512_FLATTEN,
+//    .
+//
+//     sse, float, avx2, avx512   ,  z^2 + c  simple.
+//   ,    : float-refill ( 
+//   ), de-* (  z  ), dd-* (   double),
+// CalcPointsSSE/CalcPointsAVX2 (    )  perturbation.
+//-----------------------------------------------------------------------
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//   double;     CalcPoint.
+struct MScalarOps
+{
+	typedef double Real;
+	typedef bool   Mask;
+	typedef size_t Count;
+
+	static const size_t WIDTH = 1;
+
+	static inline Real Set(const double value)                 { return value; }
+	static inline Real Add(const Real a, const Real b)         { return a + b; }
+	static inline Real Sub(const Real a, const Real b)         { return a - b; }
+	static inline Real Mul(const Real a, const Real b)         { return a * b; }
+	static inline Real Abs(const Real a)                       { return fabs(a); }
+	static inline Real MulAdd(const Real a, const Real b, const Real c) { return a * b + c; }
+
+	//        .
+	static inline Real PeriodEps()                             { return 1e-12; }
+
+	// x^2 - y^2 + c  2xy + c.
+	static inline Real SquareDiffAdd(const Real x, const Real y, const Real c)   { return x * x - y * y + c; }
+	static inline Real TwiceProductAdd(const Real x, const Real y, const Real c) { return 2 * x * y + c; }
+
+	static inline Mask LessEqual(const Real a, const Real b)   { return a <= b; }
+	static inline Mask IsNear(const Real a, const Real b, const Real eps) { return fabs(a - b) < eps; }
+
+	static inline Mask AllLanes()                              { return true; }
+	static inline Mask NoLanes()                               { return false; }
+	static inline Mask And(const Mask a, const Mask b)         { return a && b; }
+	static inline Mask AndNot(const Mask a, const Mask b)      { return !a && b; }
+	static inline Mask Or(const Mask a, const Mask b)          { return a || b; }
+	static inline bool Any(const Mask a)                       { return a; }
+	static inline size_t CountLanes(const Mask a)              { return a ? 1 : 0; }
+
+	static inline Real Select(const Mask mask, const Real a, const Real b) { return mask ? a : b; }
+
+	static inline Count SetCount(const size_t value)           { return value; }
+	static inline Count Increment(const Count count, const Mask mask) { return count + (mask ? 1 : 0); }
+	static inline Count SelectCount(const Mask mask, const Count a, const Count b) { return mask ? a : b; }
+
+	static inline Real GetPointX(const double minX, const size_t xIndex, const double step)
+	{
+		return minX + xIndex * step;
+	}
+
+	static inline double GetPointY(const double maxY, const size_t yIndex, const double step)
+	{
+		return maxY - yIndex * step;
+	}
+
+	static inline void StoreCounts(uint32_t* dst, const Count count) { dst[0] = (uint32_t)count; }
+	static inline void StoreFloats(float* dst, const Real value)     { dst[0] = (float)value; }
+};
+
+//   double  __m128d   ;     CalcPointsSSE.
+struct MSSE2Ops
+{
+	typedef __m128d Real;
+	typedef __m128d Mask;
+	typedef __m128i Count;
+
+	static const size_t WIDTH = 2;
+
+	static inline Real Set(const double value)                 { return _mm_set1_pd(value); }
+	static inline Real Add(const Real a, const Real b)         { return _mm_add_pd(a, b); }
+	static inline Real Sub(const Real a, const Real b)         { return _mm_sub_pd(a, b); }
+	static inline Real Mul(const Real a, const Real b)         { return _mm_mul_pd(a, b); }
+	static inline Real Abs(const Real a)                       { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+	static inline Real MulAdd(const Real a, const Real b, const Real c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+	static inline Real PeriodEps()                             { return _mm_set1_pd(1e-12); }
+
+	static inline Real SquareDiffAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm_add_pd(_mm_sub_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y)), c);
+	}
+
+	static inline Real TwiceProductAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm_add_pd(_mm_mul_pd(_mm_set1_pd(2), _mm_mul_pd(x, y)), c);
+	}
+
+	static inline Mask LessEqual(const Real a, const Real b)   { return _mm_cmple_pd(a, b); }
+
+	static inline Mask IsNear(const Real a, const Real b, const Real eps)
+	{
+		return _mm_cmplt_pd(Abs(_mm_sub_pd(a, b)), eps);
+	}
+
+	static inline Mask AllLanes()                              { return _mm_castsi128_pd(_mm_set1_epi64x(-1)); }
+	static inline Mask NoLanes()                               { return _mm_setzero_pd(); }
+	static inline Mask And(const Mask a, const Mask b)         { return _mm_and_pd(a, b); }
+	static inline Mask AndNot(const Mask a, const Mask b)      { return _mm_andnot_pd(a, b); }
+	static inline Mask Or(const Mask a, const Mask b)          { return _mm_or_pd(a, b); }
+	static inline bool Any(const Mask a)                       { return _mm_movemask_pd(a) != 0; }
+	static inline size_t CountLanes(const Mask a)              { return KernelStatsCountBits(_mm_movemask_pd(a)); }
+
+	static inline Real Select(const Mask mask, const Real a, const Real b)
+	{
+		return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+	}
+
+	static inline Count SetCount(const size_t value)           { return _mm_set1_epi64x((long long)value); }
+
+	//   -  -1,    .
+	static inline Count Increment(const Count count, const Mask mask)
+	{
+		return _mm_sub_epi64(count, _mm_castpd_si128(mask));
+	}
+
+	static inline Count SelectCount(const Mask mask, const Count a, const Count b)
+	{
+		return _mm_or_si128(_mm_and_si128(_mm_castpd_si128(mask), a), _mm_andnot_si128(_mm_castpd_si128(mask), b));
+	}
+
+	static inline Real GetPointX(const double minX, const size_t xIndex, const double step)
+	{
+		return _mm_add_pd(_mm_set1_pd(minX),
+						  _mm_mul_pd(_mm_add_pd(_mm_set1_pd((double)xIndex), _mm_set_pd(1, 0)), _mm_set1_pd(step)));
+	}
+
+	static inline double GetPointY(const double maxY, const size_t yIndex, const double step)
+	{
+		return maxY - yIndex * step;
+	}
+
+	static inline void StoreCounts(uint32_t* dst, const Count count)
+	{
+		_mm_storel_epi64((__m128i*)dst, _mm_shuffle_epi32(count, _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+
+	static inline void StoreFloats(float* dst, const Real value)
+	{
+		_mm_storel_pi((__m64*)dst, _mm_cvtpd_ps(value));
+	}
+};
+
+//   double  __m256d     FMA;     CalcPointsAVX2.
+struct MAVX2Ops
+{
+	typedef __m256d Real;
+	typedef __m256d Mask;
+	typedef __m256i Count;
+
+	static const size_t WIDTH = 4;
+
+	TARGET_AVX2 static inline Real Set(const double value)             { return _mm256_set1_pd(value); }
+	TARGET_AVX2 static inline Real Add(const Real a, const Real b)     { return _mm256_add_pd(a, b); }
+	TARGET_AVX2 static inline Real Sub(const Real a, const Real b)     { return _mm256_sub_pd(a, b); }
+	TARGET_AVX2 static inline Real Mul(const Real a, const Real b)     { return _mm256_mul_pd(a, b); }
+	TARGET_AVX2 static inline Real Abs(const Real a)                   { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+	TARGET_AVX2 static inline Real MulAdd(const Real a, const Real b, const Real c) { return _mm256_fmadd_pd(a, b, c); }
+	TARGET_AVX2 static inline Real PeriodEps()                         { return _mm256_set1_pd(1e-12); }
+
+	// x^2 - (y^2 - c)
+	TARGET_AVX2 static inline Real SquareDiffAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm256_fmsub_pd(x, x, _mm256_fmsub_pd(y, y, c));
+	}
+
+	// (x + x) * y + c
+	TARGET_AVX2 static inline Real TwiceProductAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm256_fmadd_pd(_mm256_add_pd(x, x), y, c);
+	}
+
+	TARGET_AVX2 static inline Mask LessEqual(const Real a, const Real b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+
+	TARGET_AVX2 static inline Mask IsNear(const Real a, const Real b, const Real eps)
+	{
+		return _mm256_cmp_pd(Abs(_mm256_sub_pd(a, b)), eps, _CMP_LT_OQ);
+	}
+
+	TARGET_AVX2 static inline Mask AllLanes()                          { return _mm256_castsi256_pd(_mm256_set1_epi64x(-1)); }
+	TARGET_AVX2 static inline Mask NoLanes()                           { return _mm256_setzero_pd(); }
+	TARGET_AVX2 static inline Mask And(const Mask a, const Mask b)     { return _mm256_and_pd(a, b); }
+	TARGET_AVX2 static inline Mask AndNot(const Mask a, const Mask b)  { return _mm256_andnot_pd(a, b); }
+	TARGET_AVX2 static inline Mask Or(const Mask a, const Mask b)      { return _mm256_or_pd(a, b); }
+	TARGET_AVX2 static inline bool Any(const Mask a)                   { return _mm256_movemask_pd(a) != 0; }
+	TARGET_AVX2 static inline size_t CountLanes(const Mask a)          { return KernelStatsCountBits(_mm256_movemask_pd(a)); }
+
+	TARGET_AVX2 static inline Real Select(const Mask mask, const Real a, const Real b)
+	{
+		return _mm256_blendv_pd(b, a, mask);
+	}
+
+	TARGET_AVX2 static inline Count SetCount(const size_t value)       { return _mm256_set1_epi64x((long long)value); }
+
+	TARGET_AVX2 static inline Count Increment(const Count count, const Mask mask)
+	{
+		return _mm256_sub_epi64(count, _mm256_castpd_si256(mask));
+	}
+
+	TARGET_AVX2 static inline Count SelectCount(const Mask mask, const Count a, const Count b)
+	{
+		return _mm256_blendv_epi8(b, a, _mm256_castpd_si256(mask));
+	}
+
+	//    FMA,  CalcPointsAVX2 (MarianiSilver.cpp)    
+	//   ,      .
+	TARGET_AVX2 static inline Real GetPointX(const double minX, const size_t xIndex, const double step)
+	{
+		return _mm256_fmadd_pd(_mm256_add_pd(_mm256_set1_pd((double)xIndex), _mm256_set_pd(3, 2, 1, 0)),
+							   _mm256_set1_pd(step), _mm256_set1_pd(minX));
+	}
+
+	TARGET_AVX2 static inline double GetPointY(const double maxY, const size_t yIndex, const double step)
+	{
+		return fma(-(double)yIndex, step, maxY);
+	}
+
+	//   64-  -    128 .
+	TARGET_AVX2 static inline void StoreCounts(uint32_t* dst, const Count count)
+	{
+		_mm_storeu_si128((__m128i*)dst,
+						 _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(count,
+																			 _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6))));
+	}
+
+	TARGET_AVX2 static inline void StoreFloats(float* dst, const Real value)
+	{
+		_mm_storeu_ps(dst, _mm256_cvtpd_ps(value));
+	}
+};
+
+//   double  __m512d (AVX-512F);  -  __mmask8,     MAVX2Ops.
+struct MAVX512Ops
+{
+	typedef __m512d  Real;
+	typedef __mmask8 Mask;
+	typedef __m512i  Count;
+
+	static const size_t WIDTH = 8;
+
+	TARGET_AVX512 static inline Real Set(const double value)           { return _mm512_set1_pd(value); }
+	TARGET_AVX512 static inline Real Add(const Real a, const Real b)   { return _mm512_add_pd(a, b); }
+	TARGET_AVX512 static inline Real Sub(const Real a, const Real b)   { return _mm512_sub_pd(a, b); }
+	TARGET_AVX512 static inline Real Mul(const Real a, const Real b)   { return _mm512_mul_pd(a, b); }
+	TARGET_AVX512 static inline Real Abs(const Real a)                 { return _mm512_abs_pd(a); }
+	TARGET_AVX512 static inline Real MulAdd(const Real a, const Real b, const Real c) { return _mm512_fmadd_pd(a, b, c); }
+	TARGET_AVX512 static inline Real PeriodEps()                       { return _mm512_set1_pd(1e-12); }
+
+	TARGET_AVX512 static inline Real SquareDiffAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm512_fmsub_pd(x, x, _mm512_fmsub_pd(y, y, c));
+	}
+
+	TARGET_AVX512 static inline Real TwiceProductAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm512_fmadd_pd(_mm512_add_pd(x, x), y, c);
+	}
+
+	TARGET_AVX512 static inline Mask LessEqual(const Real a, const Real b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+
+	TARGET_AVX512 static inline Mask IsNear(const Real a, const Real b, const Real eps)
+	{
+		return _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(a, b)), eps, _CMP_LT_OQ);
+	}
+
+	TARGET_AVX512 static inline Mask AllLanes()                        { return 0xFF; }
+	TARGET_AVX512 static inline Mask NoLanes()                         { return 0; }
+	TARGET_AVX512 static inline Mask And(const Mask a, const Mask b)   { return a & b; }
+	TARGET_AVX512 static inline Mask AndNot(const Mask a, const Mask b) { return (Mask)(~a & b); }
+	TARGET_AVX512 static inline Mask Or(const Mask a, const Mask b)    { return a | b; }
+	TARGET_AVX512 static inline bool Any(const Mask a)                 { return a != 0; }
+	TARGET_AVX512 static inline size_t CountLanes(const Mask a)        { return KernelStatsCountBits(a); }
+
+	TARGET_AVX512 static inline Real Select(const Mask mask, const Real a, const Real b)
+	{
+		return _mm512_mask_blend_pd(mask, b, a);
+	}
+
+	TARGET_AVX512 static inline Count SetCount(const size_t value)     { return _mm512_set1_epi64((long long)value); }
+
+	TARGET_AVX512 static inline Count Increment(const Count count, const Mask mask)
+	{
+		return _mm512_mask_add_epi64(count, mask, count, _mm512_set1_epi64(1));
+	}
+
+	TARGET_AVX512 static inline Count SelectCount(const Mask mask, const Count a, const Count b)
+	{
+		return _mm512_mask_blend_epi64(mask, b, a);
+	}
+
+	TARGET_AVX512 static inline Real GetPointX(const double minX, const size_t xIndex, const double step)
+	{
+		return _mm512_add_pd(_mm512_set1_pd(minX),
+							 _mm512_mul_pd(_mm512_add_pd(_mm512_set1_pd((double)xIndex),
+														 _mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0)),
+										   _mm512_set1_pd(step)));
+	}
+
+	TARGET_AVX512 static inline double GetPointY(const double maxY, const size_t yIndex, const double step)
+	{
+		return maxY - yIndex * step;
+	}
+
+	//   :   GCC    _mm256_undefined.
+	TARGET_AVX512 static inline void StoreCounts(uint32_t* dst, const Count count)
+	{
+		_mm512_mask_cvtepi64_storeu_epi32(dst, 0xFF, count);
+	}
+
+	TARGET_AVX512 static inline void StoreFloats(float* dst, const Real value)
+	{
+		_mm256_storeu_ps(dst, _mm512_maskz_cvtpd_ps(0xFF, value));
+	}
+};
+
+//   float  __m128   ;  32-,     MSSE2Ops.
+struct MFloatSSEOps
+{
+	typedef __m128  Real;
+	typedef __m128  Mask;
+	typedef __m128i Count;
+
+	static const size_t WIDTH = 4;
+
+	static inline Real Set(const double value)                 { return _mm_set_ps1((float)value); }
+	static inline Real Add(const Real a, const Real b)         { return _mm_add_ps(a, b); }
+	static inline Real Sub(const Real a, const Real b)         { return _mm_sub_ps(a, b); }
+	static inline Real Mul(const Real a, const Real b)         { return _mm_mul_ps(a, b); }
+	static inline Real Abs(const Real a)                       { return _mm_andnot_ps(_mm_set_ps1(-0.0f), a); }
+	static inline Real MulAdd(const Real a, const Real b, const Real c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+	//  float   -  1e-7,    ,   double.
+	static inline Real PeriodEps()                             { return _mm_set_ps1(1e-6f); }
+
+	static inline Real SquareDiffAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm_add_ps(_mm_sub_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), c);
+	}
+
+	static inline Real TwiceProductAdd(const Real x, const Real y, const Real c)
+	{
+		return _mm_add_ps(_mm_mul_ps(_mm_set_ps1(2), _mm_mul_ps(x, y)), c);
+	}
+
+	static inline Mask LessEqual(const Real a, const Real b)   { return _mm_cmple_ps(a, b); }
+
+	static inline Mask IsNear(const Real a, const Real b, const Real eps)
+	{
+		return _mm_cmplt_ps(Abs(_mm_sub_ps(a, b)), eps);
+	}
+
+	static inline Mask AllLanes()                              { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+	static inline Mask NoLanes()                               { return _mm_setzero_ps(); }
+	static inline Mask And(const Mask a, const Mask b)         { return _mm_and_ps(a, b); }
+	static inline Mask AndNot(const Mask a, const Mask b)      { return _mm_andnot_ps(a, b); }
+	static inline Mask Or(const Mask a, const Mask b)          { return _mm_or_ps(a, b); }
+	static inline bool Any(const Mask a)                       { return _mm_movemask_ps(a) != 0; }
+	static inline size_t CountLanes(const Mask a)              { return KernelStatsCountBits(_mm_movemask_ps(a)); }
+
+	static inline Real Select(const Mask mask, const Real a, const Real b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	static inline Count SetCount(const size_t value)           { return _mm_set1_epi32((int)value); }
+
+	static inline Count Increment(const Count count, const Mask mask)
+	{
+		return _mm_sub_epi32(count, _mm_castps_si128(mask));
+	}
+
+	static inline Count SelectCount(const Mask mask, const Count a, const Count b)
+	{
+		return _mm_or_si128(_mm_and_si128(_mm_castps_si128(mask), a), _mm_andnot_si128(_mm_castps_si128(mask), b));
+	}
+
+	//    float  ,   RenderFloatSSERefillMandelbrot.
+	static inline Real GetPointX(const double minX, const size_t xIndex, const double step)
+	{
+		return _mm_add_ps(_mm_set_ps1((float)minX),
+						  _mm_mul_ps(_mm_add_ps(_mm_set_ps1((float)xIndex), _mm_set_ps(3, 2, 1, 0)),
+									 _mm_set_ps1((float)step)));
+	}
+
+	static inline double GetPointY(const double maxY, const size_t yIndex, const double step)
+	{
+		return maxY - yIndex * step;
+	}
+
+	static inline void StoreCounts(uint32_t* dst, const Count count) { _mm_storeu_si128((__m128i*)dst, count); }
+	static inline void StoreFloats(float* dst, const Real value)     { _mm_storeu_ps(dst, value); }
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//-----------------------------------------------------------------------
+// : z(n + 1) = Step(z(n), c). FIXED_C - c      ( ),
+//  z0 -  ;  z0 = c =  . INTERIOR_CHECK -   
+//        2.
+//-----------------------------------------------------------------------
+
+// z^2 + c
+struct MMandelbrotFormula
+{
+	static const bool FIXED_C        = false;
+	static const bool INTERIOR_CHECK = true;
+
+	template <typename Ops>
+	static inline void Step(const typename Ops::Real& x,  const typename Ops::Real& y,
+							const typename Ops::Real& cX, const typename Ops::Real& cY,
+							typename Ops::Real* nextX, typename Ops::Real* nextY)
+	{
+		*nextX = Ops::SquareDiffAdd(x, y, cX);
+		*nextY = Ops::TwiceProductAdd(x, y, cY);
+	}
+
+	/**
+	 * @brief          2 (. IsInteriorPoint).
+	 *
+	 * @param interior :  ,   .
+	*/
+	template <typename Ops>
+	static inline void IsInterior(const typename Ops::Real& pointX, const typename Ops::Real& pointY,
+								  typename Ops::Mask* interior)
+	{
+		typename Ops::Real x  = Ops::Sub(pointX, Ops::Set(0.25));
+		typename Ops::Real y2 = Ops::Mul(pointY, pointY);
+		typename Ops::Real q  = Ops::MulAdd(x, x, y2);
+
+		typename Ops::Mask cardioid = Ops::LessEqual(Ops::Mul(q, Ops::Add(q, x)), Ops::Mul(Ops::Set(0.25), y2));
+
+		typename Ops::Real x1 = Ops::Add(pointX, Ops::Set(1));
+
+		typename Ops::Mask bulb = Ops::LessEqual(Ops::MulAdd(x1, x1, y2), Ops::Set(0.0625));
+
+		*interior = Ops::Or(cardioid, bulb);
+	}
+};
+
+// ,       .
+struct MNoInteriorFormula
+{
+	static const bool INTERIOR_CHECK = false;
+
+	template <typename Ops>
+	static inline void IsInterior(const typename Ops::Real&, const typename Ops::Real&, typename Ops::Mask* interior)
+	{
+		*interior = Ops::NoLanes();
+	}
+};
+
+// z^2 + c   c; z0 -  .
+struct MJuliaFormula : MNoInteriorFormula
+{
+	static const bool FIXED_C        = true;
+
+	template <typename Ops>
+	static inline void Step(const typename Ops::Real& x,  const typename Ops::Real& y,
+							const typename Ops::Real& cX, const typename Ops::Real& cY,
+							typename Ops::Real* nextX, typename Ops::Real* nextY)
+	{
+		MMandelbrotFormula::Step<Ops>(x, y, cX, cY, nextX, nextY);
+	}
+};
+
+// (|x| + i|y|)^2 + c
+struct MBurningShipFormula : MNoInteriorFormula
+{
+	static const bool FIXED_C        = false;
+
+	template <typename Ops>
+	static inline void Step(const typename Ops::Real& x,  const typename Ops::Real& y,
+							const typename Ops::Real& cX, const typename Ops::Real& cY,
+							typename Ops::Real* nextX, typename Ops::Real* nextY)
+	{
+		MMandelbrotFormula::Step<Ops>(Ops::Abs(x), Ops::Abs(y), cX, cY, nextX, nextY);
+	}
+};
+
+// z^Power + c:  - Power - 1 ,   .
+template <unsigned Power>
+struct MMultibrotFormula : MNoInteriorFormula
+{
+	static const bool FIXED_C        = false;
+
+	template <typename Ops>
+	static inline void Step(const typename Ops::Real& x,  const typename Ops::Real& y,
+							const typename Ops::Real& cX, const typename Ops::Real& cY,
+							typename Ops::Real* nextX, typename Ops::Real* nextY)
+	{
+		typename Ops::Real powX = x;
+		typename Ops::Real powY = y;
+
+		for (unsigned power = 1; power < Power; power++)
+		{
+			typename Ops::Real mulX = Ops::Sub(Ops::Mul(powX, x), Ops::Mul(powY, y));
+
+			powY = Ops::MulAdd(powX, y, Ops::Mul(powY, x));
+			powX = mulX;
+		}
+
+		*nextX = Ops::Add(powX, cX);
+		*nextY = Ops::Add(powY, cY);
+	}
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief    Formula  Ops::WIDTH   :  ,
+ *          ,    |z|^2    -   RenderSSEMandelbrot.
+ *             Ops::WIDTH.
+*/
+template <typename Formula, typename Ops>
+static inline void RenderFormulaTile(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+									 const MIterTile* iterTile)
+{
+	typedef typename Ops::Real  Real;
+	typedef typename Ops::Mask  Mask;
+	typedef typename Ops::Count Count;
+
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(map);
+	assert(params);
+	assert(tile);
+	assert(tile->width % Ops::WIDTH == 0);
+
+	//     ,    ,
+	//       ,    .
+	const double xMapStep = (map->maxX - map->minX) / frame->width;
+	const double yMapStep = (map->maxY - map->minY) / frame->height;
+
+	const Real maxR2     = Ops::Set(params->bailout * params->bailout);
+	const Real periodEps = Ops::PeriodEps();
+
+	const Real fixedX    = Ops::Set(params->juliaX);
+	const Real fixedY    = Ops::Set(params->juliaY);
+
+	const size_t maxIterations = params->maxIterations;
+	const Count  maxIters      = Ops::SetCount(maxIterations);
+
+	const bool  interiorCheck = Formula::INTERIOR_CHECK && params->interiorCheck;
+	const bool  periodCheck   = params->periodCheck;
+
+	const bool  smooth      = iterTile->fractions != nullptr;
+	const float smoothScale = GetSmoothScale(params);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		uint32_t* row       = iterTile->iterNums + (yIndex - tile->y0) * iterTile->stride;
+		uint16_t* fractions = smooth ? iterTile->fractions + (yIndex - tile->y0) * iterTile->stride : nullptr;
+
+		const Real pointY = Ops::Set(Ops::GetPointY(map->maxY, yIndex, yMapStep));
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex += Ops::WIDTH)
+		{
+			const Real pointX = Ops::GetPointX(map->minX, xIndex, xMapStep);
+
+			const Real cX = Formula::FIXED_C ? fixedX : pointX;
+			const Real cY = Formula::FIXED_C ? fixedY : pointY;
+
+			Real  curX     = pointX;
+			Real  curY     = pointY;
+
+			Count iterNum  = Ops::SetCount(0);
+
+			//          .
+			Mask  interior = Ops::NoLanes();
+
+			if (interiorCheck)
+			{
+				Formula::template IsInterior<Ops>(pointX, pointY, &interior);
+				iterNum  = Ops::SelectCount(interior, maxIters, iterNum);
+			}
+
+			Real   savedX     = curX;
+			Real   savedY     = curY;
+			//    ,  , -  ,  8.
+			size_t checkpoint = 8;
+
+			// |z|^2   :  r2, ,   .
+			Real escapeR2 = Ops::Set(0);
+			Mask active   = Ops::AllLanes();
+
+			KERNEL_STATS_VECTOR_BEGIN(stats);
+
+			for (size_t st = 0; st < maxIterations; st++)
+			{
+				Real nextX;
+				Real nextY;
+
+				Formula::template Step<Ops>(curX, curY, cX, cY, &nextX, &nextY);
+
+				Real r2 = Ops::MulAdd(nextX, nextX, Ops::Mul(nextY, nextY));
+
+				Mask cmpRes = Ops::AndNot(interior, Ops::LessEqual(r2, maxR2));
+
+				KERNEL_STATS_TRIP(stats, Ops::WIDTH, Ops::CountLanes(cmpRes));
+
+				if (smooth)
+					escapeR2 = Ops::Select(active, r2, escapeR2);
+
+				if (!Ops::Any(cmpRes))
+					break; //     
+
+				active = cmpRes;
+
+				iterNum = Ops::Increment(iterNum, cmpRes);
+
+				curX = nextX;
+				curY = nextY;
+
+				//   8 :   ,      .
+				if (periodCheck && (st & 7) == 0)
+				{
+					//    :      .
+					Mask cycle = Ops::And(cmpRes, Ops::And(Ops::IsNear(curX, savedX, periodEps),
+														   Ops::IsNear(curY, savedY, periodEps)));
+
+					interior = Ops::Or(interior, cycle);
+					iterNum  = Ops::SelectCount(cycle, maxIters, iterNum);
+
+					if (st == checkpoint)
+					{
+						savedX      = curX;
+						savedY      = curY;
+						checkpoint *= 2;
+					}
+				}
+			}
+
+			KERNEL_STATS_VECTOR_END(stats);
+
+			Ops::StoreCounts(row + xIndex - tile->x0, iterNum);
+
+			if (smooth)
+			{
+				float escapeR2f[Ops::WIDTH];
+				Ops::StoreFloats(escapeR2f, escapeR2);
+
+				GetSmoothFractions(escapeR2f, Ops::WIDTH, smoothScale, fractions + xIndex - tile->x0);
+			}
+		}
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
\ No newline at end of file
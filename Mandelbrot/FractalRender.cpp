@@ -0,0 +1,149 @@
+#include <assert.h>
+
+#include "MandelbrotRender.h"
+
+#include "CpuFeatures.h"
+#include "FractalKernel.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+template <typename Ops>
+static void RenderFractalOps(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							 const MIterTile* iterTile);
+
+static void RenderFractalScalar(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								const MIterTile* iterTile);
+
+static void RenderFractalSSE(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							 const MIterTile* iterTile);
+
+static void RenderFractalFloatSSE(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								  const MIterTile* iterTile);
+
+TARGET_AVX2_FLATTEN
+static void RenderFractalAVX2(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							  const MIterTile* iterTile);
+
+TARGET_AVX512_FLATTEN
+static void RenderFractalAVX512(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								const MIterTile* iterTile);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief   params->fractal ( params->power)  RenderFormulaTile
+ *           Ops.     IsRenderParamsValid.
+*/
+template <typename Ops>
+static inline void RenderFractalOps(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+									const MIterTile* iterTile)
+{
+	assert(params);
+
+	switch (params->fractal)
+	{
+		case MFRACTAL_MANDELBROT:
+			RenderFormulaTile<MMandelbrotFormula, Ops>(frame, map, params, tile, iterTile);
+			break;
+
+		case MFRACTAL_JULIA:
+			RenderFormulaTile<MJuliaFormula, Ops>(frame, map, params, tile, iterTile);
+			break;
+
+		case MFRACTAL_BURNING_SHIP:
+			RenderFormulaTile<MBurningShipFormula, Ops>(frame, map, params, tile, iterTile);
+			break;
+
+		case MFRACTAL_MULTIBROT:
+			switch (params->power)
+			{
+				case 3: RenderFormulaTile<MMultibrotFormula<3>, Ops>(frame, map, params, tile, iterTile); break;
+				case 4: RenderFormulaTile<MMultibrotFormula<4>, Ops>(frame, map, params, tile, iterTile); break;
+				case 5: RenderFormulaTile<MMultibrotFormula<5>, Ops>(frame, map, params, tile, iterTile); break;
+				case 6: RenderFormulaTile<MMultibrotFormula<6>, Ops>(frame, map, params, tile, iterTile); break;
+				case 7: RenderFormulaTile<MMultibrotFormula<7>, Ops>(frame, map, params, tile, iterTile); break;
+				case 8: RenderFormulaTile<MMultibrotFormula<8>, Ops>(frame, map, params, tile, iterTile); break;
+
+				default:
+					assert(!"Unsupported multibrot power");
+					break;
+			}
+			break;
+
+		default:
+			assert(!"Unknown fractal");
+			break;
+	}
+}
+
+static void RenderFractalScalar(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								const MIterTile* iterTile)
+{
+	RenderFractalOps<MScalarOps>(frame, map, params, tile, iterTile);
+}
+
+static void RenderFractalSSE(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							 const MIterTile* iterTile)
+{
+	RenderFractalOps<MSSE2Ops>(frame, map, params, tile, iterTile);
+}
+
+static void RenderFractalFloatSSE(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								  const MIterTile* iterTile)
+{
+	RenderFractalOps<MFloatSSEOps>(frame, map, params, tile, iterTile);
+}
+
+TARGET_AVX2_FLATTEN
+static void RenderFractalAVX2(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							  const MIterTile* iterTile)
+{
+	RenderFractalOps<MAVX2Ops>(frame, map, params, tile, iterTile);
+}
+
+TARGET_AVX512_FLATTEN
+static void RenderFractalAVX512(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								const MIterTile* iterTile)
+{
+	RenderFractalOps<MAVX512Ops>(frame, map, params, tile, iterTile);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief    params->fractal.  float  avx512   Ops
+ *        (4  float, 8  double).   params->kernel    :
+ *           double  4  (AVX2,   ),  2 (SSE2)    (simple),
+ *           ,  GetKernelWidth ,  . float-refill
+ *             (IsRenderParamsValid).
+*/
+void RenderFractalTile(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+					   const MIterTile* iterTile)
+{
+	assert(params);
+	assert(tile);
+
+	const size_t         kernelWidth = GetKernelWidth(params->kernel);
+	const MCpuFeatures*  features    = GetCpuFeatures();
+
+	if (params->kernel == MKERNEL_FLOAT_SSE)
+		RenderFractalFloatSSE(frame, map, params, tile, iterTile);
+
+	else if (params->kernel == MKERNEL_AVX512 && features->avx512f)
+		RenderFractalAVX512(frame, map, params, tile, iterTile);
+
+	else if (kernelWidth % MAVX2Ops::WIDTH == 0 && features->avx2 && features->fma)
+		RenderFractalAVX2(frame, map, params, tile, iterTile);
+
+	else if (kernelWidth % MSSE2Ops::WIDTH == 0)
+		RenderFractalSSE(frame, map, params, tile, iterTile);
+
+	else
+		RenderFractalScalar(frame, map, params, tile, iterTile);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,1166 @@
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "Headless.h"
+
+#include "MandelbrotRender.h"
+
+#include "ParallelRender.h"
+
+#include "Perturbation.h"
+
+#include "MarianiSilver.h"
+
+#include "IncrementalRender.h"
+
+#include "ProgressiveRender.h"
+
+#include "TileCache.h"
+
+#include "AntiAlias.h"
+
+#include "ZoomVideo.h"
+
+#include "Benchmark.h"
+
+#include "Verify.h"
+
+#include "KernelStats.h"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+
+static const char NULL_DEVICE_NAME[] = "NUL";
+#else
+static const char NULL_DEVICE_NAME[] = "/dev/null";
+#endif
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+struct MHeadlessArgs
+{
+	MKernel     kernel;
+
+	size_t      maxIterations;
+	double      bailout;
+
+	bool        interiorCheck;
+	bool        periodCheck;
+	bool        seriesApproximation;
+	bool        subdivide;
+	bool        progressive;
+	bool        smoothColoring;
+
+	size_t      width;
+	size_t      height;
+
+	MRect       map;
+
+	//     (. MRenderParams).
+	MFractal    fractal;
+	double      juliaX;
+	double      juliaY;
+	unsigned    power;
+
+	//       ; deepX == nullptr -  .
+	const char* deepX;
+	const char* deepY;
+	double      deepWidth;
+
+	size_t      repeat;
+
+	//       (  ); pan == false -  .
+	bool        pan;
+	long long   panX;
+	long long   panY;
+
+	size_t      threads;
+	size_t      tileSize;
+
+	//     ; 0 -  .
+	size_t      cacheBudget;
+	const char* cacheDir;
+
+	//        ; 0 -  .
+	size_t      recolor;
+
+	//      ; 0 -  .
+	size_t      antialias;
+
+	//    :        ; 0  -  .
+	size_t      zoomFrames;
+	double      zoomFactor;
+
+	//          (. MZoomPath); 0 -   .
+	size_t      keyframeScale;
+	size_t      keyframeTolerance;
+
+	//     ("-" -  ); nullptr -   .
+	const char* videoName;
+	MVideoFormat videoFormat;
+	size_t      videoFps;
+
+	const char* outName;
+
+	//      RunBenchmarkSuite; 0 -   .
+	size_t      benchmarkRuns;
+	const char* jsonName;
+
+	//  RunKernelVerification  ;  ,  verify == true.
+	bool        verify;
+	size_t      verifyTolerance;
+};
+
+//      ,    .
+struct MPassWatch
+{
+	const MProgressiveRender* state;
+	size_t                    step;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static void PrintUsage(const char* programName);
+
+static bool ParseKernel(const char* name, MKernel* kernel);
+
+static bool ParseFractal(const char* name, MFractal* fractal);
+
+static bool ParseSwitch(const char* option, const char* value, bool* flag);
+
+static bool ParseCount(const char* option, const char* value, const size_t minValue, const size_t maxValue,
+					   size_t* count);
+
+static bool ParseArgs(int argc, char* argv[], MHeadlessArgs* args);
+
+static void WriteLE(unsigned char* dest, const size_t value, const size_t bytes);
+
+static bool WriteBitMap(const char* fileName, const MFrame* frame);
+
+static bool IsPassFinished(void* context);
+
+static int RunZoomVideo(const MHeadlessArgs* args, const MRenderParams* params);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static void PrintUsage(const char* programName)
+{
+	printf("Usage: %s [options]\n"
+		   "  --kernel NAME               simple, sse, float, float-refill, avx2, avx512, dd-sse, dd-avx2\n"
+		   "                              or double (widest double kernel this CPU supports, double-double\n"
+		   "                              when the pixel step is too small for double; default: float);\n"
+		   "                              de-sse and de-avx2 shade by the distance estimate instead\n"
+		   "  --fractal NAME              mandelbrot, julia, burning-ship or multibrot (default: mandelbrot);\n"
+		   "                              other than mandelbrot are computed by float and avx512 as named,\n"
+		   "                              by other kernels in double with the vector width of the kernel;\n"
+		   "                              float-refill and de-* compute only mandelbrot\n"
+		   "  --julia CX CY               constant c of the julia set (default: %g %g)\n"
+		   "  --power N                   power of z for multibrot, N = %u..%u (default: %u)\n"
+		   "  --size WIDTHxHEIGHT         frame size in pixels, each side up to 16384 (default: 900x600)\n"
+		   "  --view MINX MAXX MINY MAXY  viewport on the complex plane (default: -2 1 -1 1)\n"
+		   "  --repeat N                  render the frame N times and report timing (default: 1)\n"
+		   "  --pan DX DY                 shift the view by DX, DY pixels (right, down) before every repeat\n"
+		   "                              after the first and re-render only the exposed strips\n"
+		   "  --threads N                 worker threads, 0 = one per logical CPU, up to 4 per CPU (default: 0)\n"
+		   "  --tile N                    tile side in pixels, multiple of the kernel width (default: 64)\n"
+		   "  --deep CX CY WIDTH          perturbation render around a center given with any number of digits;\n"
+		   "                              WIDTH is the view width, the height follows the frame aspect ratio\n"
+		   "  --iterations N              maximum iterations per point (default: 255)\n"
+		   "  --bailout R                 escape radius, at least 2 (default: 10)\n"
+		   "  --interior on|off           skip the main cardioid and the period-2 bulb (default: on)\n"
+		   "  --period on|off             stop points whose orbit falls into a cycle (default: off)\n"
+		   "  --series on|off             skip early iterations of --deep renders with a series (default: on)\n"
+		   "  --subdivide on|off          Mariani-Silver subdivision: fill rectangles with a uniform border\n"
+		   "                              (default: off)\n"
+		   "  --progressive on|off        render 1/8, 1/4, 1/2 and full resolution passes, reusing samples,\n"
+		   "                              and report the time of each pass (default: off)\n"
+		   "  --smooth on|off             smooth coloring: fractional iteration counts from |z| at escape\n"
+		   "                              (default: off)\n"
+		   "  --cache MB                  render through an LRU cache of iteration tiles with this memory budget\n"
+		   "  --cache-dir DIR             spill evicted tiles to an existing directory and read them back\n"
+		   "  --recolor N                 colorize the last frame N times from its iteration counts\n"
+		   "                              and report the time of one pass\n"
+		   "  --antialias N               supersample pixels whose iteration count differs from a neighbor\n"
+		   "                              with NxN jittered samples, N = 2..%zu (default: 0, off)\n"
+		   "  --zoom FRAMES FACTOR        render FRAMES frames zooming FACTOR times into the center of --view\n"
+		   "                              or --deep, with the same scale step between frames\n"
+		   "  --keyframes SCALE TOL       derive --zoom frames from keyframes rendered at SCALE times the\n"
+		   "                              resolution, SCALE = %zu..%zu, re-rendering pixels whose keyframe\n"
+		   "                              neighbors differ by more than TOL iterations (default: off)\n"
+		   "  --video FILE|-              write the --zoom frames to FILE or, with -, to stdout\n"
+		   "                              (e.g. piped into ffmpeg -i -)\n"
+		   "  --video-format y4m|rgb      YUV4MPEG2 4:2:0 with even frame size, or raw rgb24 frames\n"
+		   "                              (default: y4m)\n"
+		   "  --fps N                     frame rate written to the y4m header (default: %zu)\n"
+		   "  --out FILE.bmp              write the last rendered frame to a 32-bit bmp file\n"
+		   "  --benchmark RUNS            run every supported kernel on the fixed benchmark views (%zux%zu,\n"
+		   "                              no interior or period check, no series) and report median, p99 and\n"
+		   "                              minimum time, ns/pixel and iterations/s; other options except\n"
+		   "                              --threads are ignored\n"
+		   "  --json FILE                 also write the --benchmark results to FILE as JSON\n"
+		   "  --verify TOL                render fixed views (%zux%zu) with every supported kernel and compare\n"
+		   "                              the iteration counts with the simple kernel, reporting pixels that\n"
+		   "                              differ by more than TOL iterations; other options except --threads\n"
+		   "                              are ignored\n",
+		   programName, DEFAULT_JULIA_X, DEFAULT_JULIA_Y, MIN_MULTIBROT_POWER, MAX_MULTIBROT_POWER,
+		   MIN_MULTIBROT_POWER, MAX_ANTIALIAS_GRID, MIN_KEYFRAME_SCALE, MAX_KEYFRAME_SCALE, DEFAULT_VIDEO_FPS,
+		   BENCHMARK_WIDTH, BENCHMARK_HEIGHT, VERIFY_WIDTH, VERIFY_HEIGHT);
+}
+
+static bool ParseKernel(const char* name, MKernel* kernel)
+{
+	assert(name);
+	assert(kernel);
+
+	if (strcmp(name, "simple") == 0)
+		*kernel = MKERNEL_SIMPLE;
+	else if (strcmp(name, "sse") == 0)
+		*kernel = MKERNEL_SSE;
+	else if (strcmp(name, "float") == 0)
+		*kernel = MKERNEL_FLOAT_SSE;
+	else if (strcmp(name, "float-refill") == 0)
+		*kernel = MKERNEL_FLOAT_SSE_REFILL;
+	else if (strcmp(name, "avx2") == 0)
+		*kernel = MKERNEL_AVX2;
+	else if (strcmp(name, "avx512") == 0)
+		*kernel = MKERNEL_AVX512;
+	else if (strcmp(name, "dd-sse") == 0)
+		*kernel = MKERNEL_DD_SSE;
+	else if (strcmp(name, "dd-avx2") == 0)
+		*kernel = MKERNEL_DD_AVX2;
+	else if (strcmp(name, "de-sse") == 0)
+		*kernel = MKERNEL_DE_SSE;
+	else if (strcmp(name, "de-avx2") == 0)
+		*kernel = MKERNEL_DE_AVX2;
+	else if (strcmp(name, "double") == 0)
+		*kernel = MKERNEL_DOUBLE;
+	else
+		return false;
+
+	return true;
+}
+
+static bool ParseFractal(const char* name, MFractal* fractal)
+{
+	assert(name);
+	assert(fractal);
+
+	if (strcmp(name, "mandelbrot") == 0)
+		*fractal = MFRACTAL_MANDELBROT;
+	else if (strcmp(name, "julia") == 0)
+		*fractal = MFRACTAL_JULIA;
+	else if (strcmp(name, "burning-ship") == 0)
+		*fractal = MFRACTAL_BURNING_SHIP;
+	else if (strcmp(name, "multibrot") == 0)
+		*fractal = MFRACTAL_MULTIBROT;
+	else
+		return false;
+
+	return true;
+}
+
+static bool ParseSwitch(const char* option, const char* value, bool* flag)
+{
+	assert(option);
+	assert(value);
+	assert(flag);
+
+	if (strcmp(value, "on") == 0)
+		*flag = true;
+	else if (strcmp(value, "off") == 0)
+		*flag = false;
+	else
+	{
+		printf("Expected on or off after %s, got \"%s\".\n", option, value);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief    minValue..maxValue.    atoi,   
+ *        (strtoull      ),    .
+*/
+static bool ParseCount(const char* option, const char* value, const size_t minValue, const size_t maxValue,
+					   size_t* count)
+{
+	assert(option);
+	assert(value);
+	assert(count);
+
+	char* end = nullptr;
+
+	errno = 0;
+
+	const unsigned long long number = strtoull(value, &end, 10);
+
+	if (value[0] < '0' || value[0] > '9' || *end != '\0' || errno == ERANGE ||
+		number < minValue || number > maxValue)
+	{
+		if (maxValue == SIZE_MAX)
+			printf("Expected a number of at least %zu after %s, got \"%s\".\n", minValue, option, value);
+		else
+			printf("Expected a number in %zu..%zu after %s, got \"%s\".\n", minValue, maxValue, option, value);
+
+		return false;
+	}
+
+	*count = (size_t)number;
+
+	return true;
+}
+
+static bool ParseArgs(int argc, char* argv[], MHeadlessArgs* args)
+{
+	assert(argv);
+	assert(args);
+
+	for (int st = 1; st < argc; st++)
+	{
+		const char* arg = argv[st];
+
+		if (strcmp(arg, "--kernel") == 0 && st + 1 < argc)
+		{
+			if (!ParseKernel(argv[++st], &args->kernel))
+			{
+				printf("Unknown kernel \"%s\".\n", argv[st]);
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--size") == 0 && st + 1 < argc)
+		{
+			if (sscanf(argv[++st], "%zux%zu", &args->width, &args->height) != 2 ||
+				args->width == 0 || args->height == 0 || args->width > MAX_FRAME_SIZE || args->height > MAX_FRAME_SIZE)
+			{
+				printf("Invalid frame size \"%s\": width and height must be in 1..%zu.\n", argv[st], MAX_FRAME_SIZE);
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--view") == 0 && st + 4 < argc)
+		{
+			args->map.minX = atof(argv[++st]);
+			args->map.maxX = atof(argv[++st]);
+			args->map.minY = atof(argv[++st]);
+			args->map.maxY = atof(argv[++st]);
+		}
+		else if (strcmp(arg, "--fractal") == 0 && st + 1 < argc)
+		{
+			if (!ParseFractal(argv[++st], &args->fractal))
+			{
+				printf("Unknown fractal \"%s\".\n", argv[st]);
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--julia") == 0 && st + 2 < argc)
+		{
+			args->juliaX = atof(argv[++st]);
+			args->juliaY = atof(argv[++st]);
+		}
+		else if (strcmp(arg, "--power") == 0 && st + 1 < argc)
+		{
+			const int power = atoi(argv[++st]);
+
+			if (power < (int)MIN_MULTIBROT_POWER || power > (int)MAX_MULTIBROT_POWER)
+			{
+				printf("Multibrot power must be in %u..%u.\n", MIN_MULTIBROT_POWER, MAX_MULTIBROT_POWER);
+				return false;
+			}
+
+			args->power = (unsigned)power;
+		}
+		else if (strcmp(arg, "--deep") == 0 && st + 3 < argc)
+		{
+			args->deepX     = argv[++st];
+			args->deepY     = argv[++st];
+			args->deepWidth = atof(argv[++st]);
+		}
+		else if (strcmp(arg, "--pan") == 0 && st + 2 < argc)
+		{
+			args->pan  = true;
+			args->panX = atoll(argv[++st]);
+			args->panY = atoll(argv[++st]);
+		}
+		else if (strcmp(arg, "--repeat") == 0 && st + 1 < argc)
+		{
+			if (!ParseCount(arg, argv[++st], 1, SIZE_MAX, &args->repeat))
+				return false;
+		}
+		else if (strcmp(arg, "--threads") == 0 && st + 1 < argc)
+		{
+			if (!ParseCount(arg, argv[++st], 0, ThreadPoolGetMaxThreadCount(), &args->threads))
+				return false;
+		}
+		else if (strcmp(arg, "--tile") == 0 && st + 1 < argc)
+		{
+			if (!ParseCount(arg, argv[++st], 1, MAX_FRAME_SIZE, &args->tileSize))
+				return false;
+		}
+		else if (strcmp(arg, "--iterations") == 0 && st + 1 < argc)
+		{
+			if (!ParseCount(arg, argv[++st], 1, MAX_ITERATIONS, &args->maxIterations))
+				return false;
+		}
+		else if (strcmp(arg, "--bailout") == 0 && st + 1 < argc)
+		{
+			args->bailout = atof(argv[++st]);
+		}
+		else if (strcmp(arg, "--interior") == 0 && st + 1 < argc)
+		{
+			if (!ParseSwitch(arg, argv[++st], &args->interiorCheck))
+				return false;
+		}
+		else if (strcmp(arg, "--period") == 0 && st + 1 < argc)
+		{
+			if (!ParseSwitch(arg, argv[++st], &args->periodCheck))
+				return false;
+		}
+		else if (strcmp(arg, "--series") == 0 && st + 1 < argc)
+		{
+			if (!ParseSwitch(arg, argv[++st], &args->seriesApproximation))
+				return false;
+		}
+		else if (strcmp(arg, "--subdivide") == 0 && st + 1 < argc)
+		{
+			if (!ParseSwitch(arg, argv[++st], &args->subdivide))
+				return false;
+		}
+		else if (strcmp(arg, "--progressive") == 0 && st + 1 < argc)
+		{
+			if (!ParseSwitch(arg, argv[++st], &args->progressive))
+				return false;
+		}
+		else if (strcmp(arg, "--smooth") == 0 && st + 1 < argc)
+		{
+			if (!ParseSwitch(arg, argv[++st], &args->smoothColoring))
+				return false;
+		}
+		else if (strcmp(arg, "--cache") == 0 && st + 1 < argc)
+		{
+			args->cacheBudget = (size_t)atoi(argv[++st]) * 1024 * 1024;
+
+			if (args->cacheBudget == 0)
+			{
+				printf("Cache budget must be at least 1 MB.\n");
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--cache-dir") == 0 && st + 1 < argc)
+		{
+			args->cacheDir = argv[++st];
+		}
+		else if (strcmp(arg, "--recolor") == 0 && st + 1 < argc)
+		{
+			args->recolor = (size_t)atoi(argv[++st]);
+		}
+		else if (strcmp(arg, "--antialias") == 0 && st + 1 < argc)
+		{
+			args->antialias = (size_t)atoi(argv[++st]);
+
+			if (args->antialias == 1 || args->antialias > MAX_ANTIALIAS_GRID)
+			{
+				printf("Anti-aliasing grid must be 0 or 2..%zu.\n", MAX_ANTIALIAS_GRID);
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--zoom") == 0 && st + 2 < argc)
+		{
+			args->zoomFrames = (size_t)atoi(argv[++st]);
+			args->zoomFactor = atof(argv[++st]);
+
+			if (args->zoomFrames == 0 || !(args->zoomFactor > 0))
+			{
+				printf("Zoom needs at least one frame and a positive factor.\n");
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--keyframes") == 0 && st + 2 < argc)
+		{
+			args->keyframeScale     = (size_t)atoi(argv[++st]);
+			args->keyframeTolerance = (size_t)atoi(argv[++st]);
+
+			if (args->keyframeScale < MIN_KEYFRAME_SCALE || args->keyframeScale > MAX_KEYFRAME_SCALE)
+			{
+				printf("Keyframe scale must be in %zu..%zu.\n", MIN_KEYFRAME_SCALE, MAX_KEYFRAME_SCALE);
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--video") == 0 && st + 1 < argc)
+		{
+			args->videoName = argv[++st];
+		}
+		else if (strcmp(arg, "--video-format") == 0 && st + 1 < argc)
+		{
+			const char* format = argv[++st];
+
+			if (strcmp(format, "y4m") == 0)
+				args->videoFormat = MVIDEO_Y4M;
+			else if (strcmp(format, "rgb") == 0)
+				args->videoFormat = MVIDEO_RGB;
+			else
+			{
+				printf("Unknown video format \"%s\".\n", format);
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--fps") == 0 && st + 1 < argc)
+		{
+			args->videoFps = (size_t)atoi(argv[++st]);
+
+			if (args->videoFps == 0)
+			{
+				printf("Frame rate must be positive.\n");
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--out") == 0 && st + 1 < argc)
+		{
+			args->outName = argv[++st];
+		}
+		else if (strcmp(arg, "--benchmark") == 0 && st + 1 < argc)
+		{
+			args->benchmarkRuns = (size_t)atoi(argv[++st]);
+
+			if (args->benchmarkRuns == 0)
+			{
+				printf("Benchmark needs at least one run.\n");
+				return false;
+			}
+		}
+		else if (strcmp(arg, "--json") == 0 && st + 1 < argc)
+		{
+			args->jsonName = argv[++st];
+		}
+		else if (strcmp(arg, "--verify") == 0 && st + 1 < argc)
+		{
+			args->verify          = true;
+			args->verifyTolerance = (size_t)atoi(argv[++st]);
+		}
+		else
+		{
+			PrintUsage(argv[0]);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void WriteLE(unsigned char* dest, const size_t value, const size_t bytes)
+{
+	assert(dest);
+
+	for (size_t st = 0; st < bytes; st++)
+		dest[st] = (unsigned char)(value >> (8 * st));
+}
+
+/**
+ * @brief    32- bmp .       ,
+ *            TXLib,       .
+ *
+ * @param fileName   .
+ * @param frame    .
+ *
+ * @return false   .
+*/
+static bool WriteBitMap(const char* fileName, const MFrame* frame)
+{
+	assert(fileName);
+	assert(frame);
+
+	const size_t fileHeaderSize = 14;
+	const size_t infoHeaderSize = 40;
+	const size_t dataSize       = frame->width * frame->height * sizeof(RGBQUAD);
+
+	unsigned char header[fileHeaderSize + infoHeaderSize] = {};
+
+	header[0] = 'B';
+	header[1] = 'M';
+	WriteLE(header + 2,  fileHeaderSize + infoHeaderSize + dataSize, 4);
+	WriteLE(header + 10, fileHeaderSize + infoHeaderSize,            4);
+
+	unsigned char* info = header + fileHeaderSize;
+
+	WriteLE(info + 0,  infoHeaderSize, 4);
+	WriteLE(info + 4,  frame->width,   4);
+	WriteLE(info + 8,  frame->height,  4);
+	WriteLE(info + 12, 1,              2); // biPlanes
+	WriteLE(info + 14, 32,             2); // biBitCount
+	WriteLE(info + 20, dataSize,       4);
+
+	FILE* file = fopen(fileName, "wb");
+
+	if (!file)
+	{
+		printf("Cannot open \"%s\" for writing.\n", fileName);
+		return false;
+	}
+
+	bool written = fwrite(header, sizeof(header), 1, file) == 1;
+
+	//  32- bmp  ,     (stride - width)    .
+	for (size_t y = 0; y < frame->height && written; y++)
+		written = fwrite(frame->pixels + y * frame->stride, sizeof(RGBQUAD), frame->width, file) == frame->width;
+
+	fclose(file);
+
+	if (!written)
+		printf("Failed to write \"%s\".\n", fileName);
+
+	return written;
+}
+
+static bool IsPassFinished(void* context)
+{
+	assert(context);
+
+	const MPassWatch* watch = (const MPassWatch*)context;
+
+	return watch->state->step != watch->step;
+}
+
+/**
+ * @brief     --view  --deep     --video.
+ *             ,    stderr.
+ *
+ * @return   .
+*/
+static int RunZoomVideo(const MHeadlessArgs* args, const MRenderParams* params)
+{
+	assert(args);
+	assert(params);
+
+	const bool toStdout = args->videoName && strcmp(args->videoName, "-") == 0;
+
+	FILE* report = toStdout ? stderr : stdout;
+
+	//      ,       --deep.
+	char centerX[32] = "";
+	char centerY[32] = "";
+
+	MZoomPath path =
+	{
+		args->deepX,
+		args->deepY,
+		args->deepWidth,
+		0,
+		args->zoomFrames,
+		args->deepX != nullptr,
+		args->keyframeScale,
+		args->keyframeTolerance
+	};
+
+	if (!args->deepX)
+	{
+		snprintf(centerX, sizeof(centerX), "%.17g", (args->map.minX + args->map.maxX) / 2);
+		snprintf(centerY, sizeof(centerY), "%.17g", (args->map.minY + args->map.maxY) / 2);
+
+		path.centerX    = centerX;
+		path.centerY    = centerY;
+		path.startWidth = args->map.maxX - args->map.minX;
+	}
+
+	path.endWidth = path.startWidth / args->zoomFactor;
+
+	MVideoOutput output = { nullptr, args->videoFormat, args->videoFps };
+
+	if (toStdout)
+	{
+#ifdef _WIN32
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+		output.file = stdout;
+	}
+	else
+	{
+		//  --video       ,  .
+		output.file = fopen(args->videoName ? args->videoName : NULL_DEVICE_NAME, "wb");
+
+		if (!output.file)
+		{
+			fprintf(report, "Cannot open \"%s\" for writing.\n", args->videoName ? args->videoName : NULL_DEVICE_NAME);
+			return 1;
+		}
+	}
+
+	MThreadPool* pool = ThreadPoolCreate(args->threads);
+
+	if (!pool)
+	{
+		fprintf(report, "Cannot start the worker threads.\n");
+
+		if (!toStdout)
+			fclose(output.file);
+
+		return 1;
+	}
+
+	MZoomVideoStats stats = {};
+
+	auto start = std::chrono::steady_clock::now();
+
+	bool rendered = RenderZoomVideo(pool, &path, args->width, args->height, params, args->tileSize, &output, &stats);
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	ThreadPoolDestroy(pool);
+
+	if (!toStdout)
+		rendered = fclose(output.file) == 0 && rendered;
+
+	if (!rendered)
+	{
+		fprintf(report, "Zoom stopped after %zu frame(s): the output failed, or the view is invalid\n"
+						"(tile size %zu must be a multiple of %zu; with --deep the pixel size must stay at least %g\n"
+						"and the center within the bailout radius for 2 iterations; a keyframe must fit in %zux%zu),\n"
+						"or memory ran out.\n",
+				stats.frames, args->tileSize, GetKernelWidth(params->kernel), MIN_DEEP_PIXEL_SIZE,
+				MAX_FRAME_SIZE, MAX_FRAME_SIZE);
+		return 1;
+	}
+
+	fprintf(report, "%s%s%s: zoom x%g, %zu frame(s) %zux%zu in %.3lf s: %.3lf ms/frame, %.2lf FPS\n",
+			GetKernelName(params->kernel), args->deepX ? " (perturbation)" : "",
+			args->smoothColoring ? " (smooth)" : "", args->zoomFactor, stats.frames, args->width, args->height,
+			seconds, seconds * 1000 / stats.frames, stats.frames / seconds);
+
+	fprintf(report, "Zoom: orbit %.3lf s, render %.3lf s, write %.3lf s; render waited %.3lf s for a buffer,\n"
+					"writer waited %.3lf s for a frame\n",
+			stats.orbitSeconds, stats.renderSeconds, stats.writeSeconds, stats.renderWaitSeconds,
+			stats.writeWaitSeconds);
+
+	if (args->keyframeScale)
+		fprintf(report, "Keyframes: %zu at %zux%zu in %.3lf s, %.1lf%% of the frame pixels rendered exactly\n",
+				stats.keyframes, args->width * args->keyframeScale, args->height * args->keyframeScale,
+				stats.keyframeSeconds, 100.0 * stats.exactPixels / ((double)args->width * args->height * stats.frames));
+
+	return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief     ,    .
+ *
+ * @return   .
+*/
+int RunHeadless(int argc, char* argv[])
+{
+	assert(argv);
+
+	// ,    ,    (0, false, nullptr).
+	MHeadlessArgs args = {};
+
+	args.kernel              = MKERNEL_FLOAT_SSE;
+	args.maxIterations       = DEFAULT_MAX_ITERATIONS;
+	args.bailout             = DEFAULT_BAILOUT;
+	args.interiorCheck       = true;
+	args.seriesApproximation = true;
+	args.width               = 900;
+	args.height              = 600;
+	args.map                 = MRect { -2, 1, -1, 1 };
+	args.fractal             = MFRACTAL_MANDELBROT;
+	args.juliaX              = DEFAULT_JULIA_X;
+	args.juliaY              = DEFAULT_JULIA_Y;
+	args.power               = MIN_MULTIBROT_POWER;
+	args.repeat              = 1;
+	args.tileSize            = DEFAULT_TILE_SIZE;
+	args.videoFormat         = MVIDEO_Y4M;
+	args.videoFps            = DEFAULT_VIDEO_FPS;
+
+	if (!ParseArgs(argc, argv, &args))
+		return 1;
+
+	if (args.jsonName && !args.benchmarkRuns)
+	{
+		puts("--json needs --benchmark.");
+		return 1;
+	}
+
+	if (args.benchmarkRuns)
+	{
+		MThreadPool* pool = ThreadPoolCreate(args.threads);
+
+		if (!pool)
+		{
+			puts("Cannot start the worker threads.");
+			return 1;
+		}
+
+		bool finished = RunBenchmarkSuite(pool, args.benchmarkRuns, args.jsonName);
+
+		ThreadPoolDestroy(pool);
+
+		return finished ? 0 : 1;
+	}
+
+	if (args.verify)
+	{
+		MThreadPool* pool = ThreadPoolCreate(args.threads);
+
+		if (!pool)
+		{
+			puts("Cannot start the worker threads.");
+			return 1;
+		}
+
+		bool passed = RunKernelVerification(pool, args.verifyTolerance);
+
+		ThreadPoolDestroy(pool);
+
+		return passed ? 0 : 1;
+	}
+
+	if (args.zoomFrames && (args.pan || args.progressive || args.subdivide || args.cacheBudget || args.cacheDir ||
+							args.antialias || args.recolor || args.outName))
+	{
+		puts("--zoom works only without --pan, --progressive, --subdivide, --cache, --antialias, --recolor\n"
+			 "and --out.");
+		return 1;
+	}
+
+	if ((args.videoName || args.keyframeScale) && !args.zoomFrames)
+	{
+		puts("--video and --keyframes need --zoom.");
+		return 1;
+	}
+
+	if (args.zoomFrames && args.videoFormat == MVIDEO_Y4M && (args.width % 2 != 0 || args.height % 2 != 0))
+	{
+		puts("--video-format y4m needs an even frame width and height.");
+		return 1;
+	}
+
+	if ((args.pan || args.progressive) && (args.deepX || args.subdivide))
+	{
+		puts("--pan and --progressive work only without --deep and --subdivide.");
+		return 1;
+	}
+
+	if (args.pan && args.progressive)
+	{
+		puts("--pan and --progressive cannot be combined.");
+		return 1;
+	}
+
+	if (args.cacheBudget && (args.deepX || args.subdivide || args.progressive))
+	{
+		puts("--cache works only without --deep, --subdivide and --progressive.");
+		return 1;
+	}
+
+	if (args.smoothColoring && (args.subdivide || args.cacheBudget))
+	{
+		puts("--smooth works only without --subdivide and --cache: they keep integer iteration counts.");
+		return 1;
+	}
+
+	const bool distance = IsDistanceKernel(args.kernel);
+
+	if (distance && (args.deepX || args.subdivide || args.cacheBudget || args.cacheDir || args.smoothColoring))
+	{
+		puts("de-sse and de-avx2 work only without --deep, --subdivide, --cache and --smooth.");
+		return 1;
+	}
+
+	if (args.keyframeScale && (args.deepX || args.smoothColoring || distance || args.fractal != MFRACTAL_MANDELBROT))
+	{
+		puts("--keyframes works only with mandelbrot, without --deep, --smooth and distance-estimation kernels.");
+		return 1;
+	}
+
+	if (args.antialias && (args.deepX || args.subdivide || args.cacheBudget || args.cacheDir || args.pan ||
+						   args.progressive || args.smoothColoring || distance))
+	{
+		puts("--antialias works only without --deep, --subdivide, --cache, --pan, --progressive, --smooth\n"
+			 "and distance-estimation kernels.");
+		return 1;
+	}
+
+	//    z^2 + c  (CalcPointsSSE/AVX2   ).
+	if (args.fractal != MFRACTAL_MANDELBROT &&
+		(args.deepX || args.subdivide || args.cacheBudget || args.cacheDir || args.antialias || distance ||
+		 args.kernel == MKERNEL_FLOAT_SSE_REFILL))
+	{
+		puts("--fractal other than mandelbrot works only without --deep, --subdivide, --cache, --antialias,\n"
+			 "float-refill and distance-estimation kernels.");
+		return 1;
+	}
+
+	if (args.fractal == MFRACTAL_MULTIBROT && args.smoothColoring)
+	{
+		puts("--smooth works only with the quadratic fractals, not with multibrot.");
+		return 1;
+	}
+
+	if (args.cacheDir && !args.cacheBudget)
+		args.cacheBudget = DEFAULT_TILE_CACHE_BUDGET;
+
+	MFrame frameSize = {};
+
+	frameSize.width  = args.width;
+	frameSize.height = args.height;
+	frameSize.stride = args.width;
+
+	//        (. RenderZoomVideo).
+	if (args.kernel == MKERNEL_DOUBLE && !args.zoomFrames)
+		args.kernel = GetDoubleKernel(&frameSize, &args.map);
+
+	//      double.
+	if (args.antialias && !IsDoublePrecisionEnough(&frameSize, &args.map))
+	{
+		puts("--antialias needs a pixel step the double kernels can resolve.");
+		return 1;
+	}
+
+	if (args.deepX)
+		args.kernel = GetPerturbationKernel(args.kernel);
+	else if (args.subdivide)
+		args.kernel = GetSubdivisionKernel(args.kernel);
+
+	if (!IsKernelSupported(args.kernel))
+	{
+		printf("Kernel \"%s\" is not supported by this CPU.\n", GetKernelName(args.kernel));
+		return 1;
+	}
+
+	MRenderParams params = {};
+
+	params.kernel              = args.kernel;
+	params.maxIterations       = args.maxIterations;
+	params.bailout             = args.bailout;
+	params.interiorCheck       = args.interiorCheck;
+	params.periodCheck         = args.periodCheck;
+	params.seriesApproximation = args.seriesApproximation;
+	params.smoothColoring      = args.smoothColoring;
+	params.fractal             = args.fractal;
+	params.juliaX              = args.juliaX;
+	params.juliaY              = args.juliaY;
+	params.power               = args.power;
+
+	if (!IsRenderParamsValid(&params))
+	{
+		printf("Iterations must be in 1..%zu and the bailout radius at least 2 (at most %g with --smooth).\n",
+			   MAX_ITERATIONS, SMOOTH_MAX_BAILOUT);
+		return 1;
+	}
+
+	if (args.zoomFrames)
+		return RunZoomVideo(&args, &params);
+
+	//     de-sse  de-avx2.
+	MFrame frame = {};
+
+	if (!FrameCreate(&frame, args.width, args.height, true, true, distance))
+	{
+		puts("Not enough memory for the frame.");
+		return 1;
+	}
+
+	MDeepView view =
+	{
+		args.deepX,
+		args.deepY,
+		args.deepWidth,
+		args.deepWidth * args.height / args.width
+	};
+
+	MThreadPool* pool = ThreadPoolCreate(args.threads);
+
+	MIncrementalRender incremental = {};
+
+	IncrementalRenderReset(&incremental);
+
+	size_t renderedPixels = 0;
+
+	//        .
+	size_t edgePixels = 0;
+
+	MProgressiveRender progressive = {};
+
+	//          : result = 1  .
+	int result = 0;
+
+	if (!pool)
+	{
+		puts("Cannot start the worker threads.");
+		result = 1;
+	}
+
+	MTileCache* cache = args.cacheBudget ? TileCacheCreate(args.cacheBudget, args.cacheDir) : nullptr;
+
+	if (args.cacheBudget && !cache)
+	{
+		puts("Not enough memory for the tile cache.");
+		result = 1;
+	}
+
+	//    1/8, 1/4, 1/2   .
+	double passSeconds[4] = {};
+
+	KernelStatsReset();
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (size_t st = 0; st < args.repeat && result == 0; st++)
+	{
+		if (args.deepX && !RenderDeepMandelbrotParallel(pool, &frame, &view, &params, args.tileSize))
+		{
+			printf("Cannot render the deep view: the center must be a decimal number that stays within\n"
+				   "the bailout radius for 2 iterations, the pixel size at least %g, and tile size %zu\n"
+				   "a multiple of %zu; or memory ran out.\n",
+				   MIN_DEEP_PIXEL_SIZE, args.tileSize, GetKernelWidth(args.kernel));
+			result = 1;
+			break;
+		}
+
+		if (!args.deepX && args.subdivide &&
+			!RenderMarianiSilverParallel(pool, &frame, &args.map, &params, args.tileSize))
+		{
+			printf("Tile size %zu must be a multiple of %zu required by kernel \"%s\", or memory ran out.\n",
+				   args.tileSize, GetKernelWidth(args.kernel), GetKernelName(args.kernel));
+			result = 1;
+			break;
+		}
+
+		bool rendered = true;
+
+		MRect map = args.map;
+
+		if (args.pan)
+		{
+			const double xMapStep = (args.map.maxX - args.map.minX) / args.width;
+			const double yMapStep = (args.map.maxY - args.map.minY) / args.height;
+
+			const double shiftX   =  (double)((long long)st * args.panX) * xMapStep;
+			const double shiftY   = -(double)((long long)st * args.panY) * yMapStep;
+
+			map = MRect { args.map.minX + shiftX, args.map.maxX + shiftX,
+						  args.map.minY + shiftY, args.map.maxY + shiftY };
+		}
+
+		if (cache)
+		{
+			if (!RenderMandelbrotCached(cache, pool, &frame, &map, &params))
+			{
+				printf("Cannot render through the tile cache: the view is too deep or memory ran out.\n");
+				result = 1;
+				break;
+			}
+		}
+		else if (args.pan)
+		{
+			rendered = RenderMandelbrotIncremental(&incremental, pool, &frame, &map, &params, args.tileSize);
+			renderedPixels += incremental.renderedPixels;
+		}
+		else if (args.progressive)
+		{
+			ProgressiveRenderReset(&progressive);
+
+			size_t pass = 0;
+
+			do
+			{
+				MPassWatch watch = { &progressive, progressive.valid ? progressive.step : PROGRESSIVE_FIRST_STEP };
+
+				auto passStart = std::chrono::steady_clock::now();
+
+				rendered = RenderMandelbrotProgressive(&progressive, pool, &frame, &args.map, &params, args.tileSize,
+													   IsPassFinished, &watch);
+
+				passSeconds[pass++] += std::chrono::duration<double>(std::chrono::steady_clock::now() - passStart).count();
+			}
+			while (rendered && progressive.step != 0 && pass < 4);
+		}
+		else if (args.antialias)
+			rendered = RenderMandelbrotAntiAliased(pool, &frame, &args.map, &params, args.tileSize, args.antialias,
+												   &edgePixels);
+		else if (!args.deepX && !args.subdivide)
+			rendered = RenderMandelbrotParallel(pool, &frame, &args.map, &params, args.tileSize);
+
+		if (!rendered)
+		{
+			printf("Tile size %zu must be a multiple of %zu required by kernel \"%s\", or memory ran out.\n",
+				   args.tileSize, GetKernelWidth(args.kernel), GetKernelName(args.kernel));
+			result = 1;
+		}
+	}
+
+	auto finish = std::chrono::steady_clock::now();
+
+	double seconds = std::chrono::duration<double>(finish - start).count();
+
+	if (result == 0)
+	{
+		char fractalTag[32] = "";
+
+		if (args.fractal == MFRACTAL_MULTIBROT)
+			snprintf(fractalTag, sizeof(fractalTag), " (multibrot z^%u)", args.power);
+		else if (args.fractal != MFRACTAL_MANDELBROT)
+			snprintf(fractalTag, sizeof(fractalTag), " (%s)", GetFractalName(args.fractal));
+
+		printf("%s%s%s%s%s%s%s%s%s%s%s: %zu frame(s) %zux%zu in %.3lf s: %.3lf ms/frame, %.2lf FPS\n",
+			   GetKernelName(args.kernel), fractalTag, args.deepX ? " (perturbation)" : "",
+			   !args.deepX && args.subdivide ? " (subdivision)" : "", args.interiorCheck ? "" : " (no interior check)",
+			   args.periodCheck ? " (period check)" : "", args.deepX && !args.seriesApproximation ? " (no series)" : "",
+			   args.pan ? " (pan)" : args.progressive ? " (progressive)" : "",
+			   args.cacheBudget ? " (tile cache)" : "", args.smoothColoring ? " (smooth)" : "",
+			   args.antialias ? " (anti-aliased)" : "", args.repeat, args.width, args.height, seconds,
+			   seconds * 1000 / args.repeat, args.repeat / seconds);
+
+		if (cache)
+			TileCachePrintStats(cache);
+		else if (args.pan)
+			printf("Pan: computed %.1lf%% of the pixels, the rest shifted from the previous frame\n",
+				   100.0 * renderedPixels / ((double)args.width * args.height * args.repeat));
+
+		if (args.antialias)
+			printf("Anti-aliasing: supersampled %.1lf%% of the pixels with %zu samples each\n",
+				   100.0 * edgePixels / ((double)args.width * args.height), args.antialias * args.antialias);
+
+		if (args.progressive)
+			printf("Passes: 1/8 %.3lf ms, 1/4 %.3lf ms, 1/2 %.3lf ms, full %.3lf ms per frame\n",
+				   passSeconds[0] * 1000 / args.repeat, passSeconds[1] * 1000 / args.repeat,
+				   passSeconds[2] * 1000 / args.repeat, passSeconds[3] * 1000 / args.repeat);
+
+		if (KERNEL_STATS_ENABLED)
+			KernelStatsPrint();
+
+		ThreadPoolPrintStats(pool);
+
+		if (args.recolor)
+		{
+			auto recolorStart = std::chrono::steady_clock::now();
+
+			for (size_t st = 0; st < args.recolor; st++)
+				ColorizeFrame(&frame);
+
+			double recolorSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - recolorStart).count();
+
+			printf("Recolor: %zu pass(es) in %.3lf s: %.3lf ms/pass, %.2lf ns/pixel\n", args.recolor, recolorSeconds,
+				   recolorSeconds * 1000 / args.recolor,
+				   recolorSeconds * 1e9 / ((double)args.recolor * args.width * args.height));
+		}
+
+		if (args.outName && !WriteBitMap(args.outName, &frame))
+			result = 1;
+	}
+
+	TileCacheDestroy(cache);
+	ThreadPoolDestroy(pool);
+	FrameDestroy(&frame);
+
+	return result;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
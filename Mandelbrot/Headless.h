@@ -0,0 +1,6 @@
+#ifndef HEADLESS_H_
+#define HEADLESS_H_
+
+int RunHeadless(int argc, char* argv[]);
+
+#endif
\ No newline at end of file
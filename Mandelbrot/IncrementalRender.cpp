@@ -0,0 +1,222 @@
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include "IncrementalRender.h"
+
+#include "ParallelRender.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static bool GetPixelShift(const MIncrementalRender* state, const MFrame* frame, const MRect* map,
+						  long long* shiftX, long long* shiftY);
+
+static void ShiftPixels(const MFrame* frame, const long long shiftX, const long long shiftY);
+
+static size_t RoundUp(const size_t value, const size_t multiple);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief ,  map -  ,     
+ *           ,   :  (x, y)   - 
+ *         (x + shiftX, y + shiftY) .
+*/
+static bool GetPixelShift(const MIncrementalRender* state, const MFrame* frame, const MRect* map,
+						  long long* shiftX, long long* shiftY)
+{
+	assert(state);
+	assert(frame);
+	assert(map);
+	assert(shiftX);
+	assert(shiftY);
+
+	const double xMapStep = (map->maxX - map->minX) / frame->width;
+	const double yMapStep = (map->maxY - map->minY) / frame->height;
+
+	const double prevXMapStep = (state->map.maxX - state->map.minX) / frame->width;
+	const double prevYMapStep = (state->map.maxY - state->map.minY) / frame->height;
+
+	//             .
+	if (fabs(xMapStep - prevXMapStep) * frame->width  > PAN_PIXEL_TOLERANCE * xMapStep ||
+		fabs(yMapStep - prevYMapStep) * frame->height > PAN_PIXEL_TOLERANCE * yMapStep)
+		return false;
+
+	const double pixelsX = (map->minX - state->map.minX) / xMapStep;
+
+	//  0 - maxY,       .
+	const double pixelsY = (state->map.maxY - map->maxY) / yMapStep;
+
+	if (!(fabs(pixelsX) < (double)frame->width && fabs(pixelsY) < (double)frame->height))
+		return false;
+
+	*shiftX = llround(pixelsX);
+	*shiftY = llround(pixelsY);
+
+	return fabs(pixelsX - (double)*shiftX) <= PAN_PIXEL_TOLERANCE &&
+		   fabs(pixelsY - (double)*shiftY) <= PAN_PIXEL_TOLERANCE;
+}
+
+/**
+ * @brief     : new(x, y) = old(x + shiftX, y + shiftY).
+ *            ,      .
+ *         ,     ,   ,   .
+*/
+static void ShiftPixels(const MFrame* frame, const long long shiftX, const long long shiftY)
+{
+	assert(frame);
+	assert(frame->pixels);
+
+	const long long width  = (long long)frame->width;
+	const long long height = (long long)frame->height;
+	const long long stride = (long long)frame->stride;
+
+	const long long dstX   = shiftX >= 0 ? 0 : -shiftX;
+	const long long srcX   = shiftX >= 0 ? shiftX : 0;
+	const size_t    count  = (size_t)(width - (shiftX >= 0 ? shiftX : -shiftX));
+
+	const long long firstY = shiftY >= 0 ? 0 : height - 1;
+	const long long stepY  = shiftY >= 0 ? 1 : -1;
+
+	for (long long y = firstY; y >= 0 && y < height; y += stepY)
+	{
+		const long long srcY = y + shiftY;
+
+		if (srcY < 0 || srcY >= height)
+			continue;
+
+		memmove(frame->pixels + y    * stride + dstX,
+				frame->pixels + srcY * stride + srcX,
+				count * sizeof(RGBQUAD));
+
+		if (frame->iterNums)
+			memmove(frame->iterNums + y    * stride + dstX,
+					frame->iterNums + srcY * stride + srcX,
+					count * sizeof(uint32_t));
+
+		if (frame->fractions)
+			memmove(frame->fractions + y    * stride + dstX,
+					frame->fractions + srcY * stride + srcX,
+					count * sizeof(uint16_t));
+
+		if (frame->distances)
+			memmove(frame->distances + y    * stride + dstX,
+					frame->distances + srcY * stride + srcX,
+					count * sizeof(float));
+	}
+}
+
+static size_t RoundUp(const size_t value, const size_t multiple)
+{
+	assert(multiple > 0);
+
+	return (value + multiple - 1) / multiple * multiple;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+void IncrementalRenderReset(MIncrementalRender* state)
+{
+	assert(state);
+
+	*state = MIncrementalRender {};
+}
+
+/**
+ * @brief  ,       :  
+ *                    ,
+ *          ,     .  
+ *         .      .
+ *
+ *                .
+ *                
+ *        (  PAN_PIXEL_TOLERANCE):     double.
+ *
+ * @return false,    ,       
+ *           .     .
+*/
+bool RenderMandelbrotIncremental(MIncrementalRender* state, MThreadPool* pool, const MFrame* frame,
+								 const MRect* map, const MRenderParams* params, const size_t tileSize)
+{
+	assert(state);
+	assert(pool);
+	assert(frame);
+	assert(map);
+	assert(params);
+
+	long long shiftX = 0;
+	long long shiftY = 0;
+
+	const bool reuse = state->valid && state->width == frame->width && state->height == frame->height &&
+					   IsSameRenderParams(&state->params, params) &&
+					   GetPixelShift(state, frame, map, &shiftX, &shiftY);
+
+	state->valid = false;
+
+	if (!reuse)
+	{
+		if (!RenderMandelbrotParallel(pool, frame, map, params, tileSize))
+			return false;
+
+		state->renderedPixels = frame->width * frame->height;
+	}
+	else
+	{
+		MKernel kernel = params->kernel;
+
+		if (kernel == MKERNEL_DOUBLE)
+			kernel = GetDoubleKernel(frame, map);
+
+		ShiftPixels(frame, shiftX, shiftY);
+
+		const size_t width   = frame->width;
+		const size_t height  = frame->height;
+
+		const size_t exposedRows = (size_t)(shiftY >= 0 ? shiftY : -shiftY);
+		//     ,        .
+		size_t exposedCols = shiftX == 0 ? 0 :
+			RoundUp((size_t)(shiftX >= 0 ? shiftX : -shiftX), GetKernelWidth(kernel));
+
+		if (exposedCols > width)
+			exposedCols = width;
+
+		//           .
+		const MTile rows =
+		{
+			0,
+			shiftY >= 0 ? height - exposedRows : 0,
+			width,
+			exposedRows
+		};
+
+		const MTile cols =
+		{
+			shiftX >= 0 ? width - exposedCols : 0,
+			shiftY >= 0 ? 0 : exposedRows,
+			exposedCols,
+			height - exposedRows
+		};
+
+		if (rows.height > 0 && !RenderMandelbrotRegionParallel(pool, frame, map, params, &rows, tileSize))
+			return false;
+
+		if (cols.width > 0 && !RenderMandelbrotRegionParallel(pool, frame, map, params, &cols, tileSize))
+			return false;
+
+		state->renderedPixels = rows.width * rows.height + cols.width * cols.height;
+	}
+
+	state->valid  = true;
+	state->map    = *map;
+	state->params = *params;
+	state->width  = frame->width;
+	state->height = frame->height;
+
+	return true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
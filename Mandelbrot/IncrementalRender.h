@@ -0,0 +1,29 @@
+#ifndef INCREMENTAL_RENDER_H_
+#define INCREMENTAL_RENDER_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//      ,         .
+const double PAN_PIXEL_TOLERANCE = 1e-3;
+
+struct MIncrementalRender
+{
+	//    ,     .
+	bool          valid;
+	MRect         map;
+	MRenderParams params;
+	size_t        width;
+	size_t        height;
+
+	//      RenderMandelbrotIncremental.
+	size_t        renderedPixels;
+};
+
+void IncrementalRenderReset(MIncrementalRender* state);
+
+bool RenderMandelbrotIncremental(MIncrementalRender* state, MThreadPool* pool, const MFrame* frame,
+								 const MRect* map, const MRenderParams* params, const size_t tileSize);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <assert.h>
+#include <stdio.h>
+#include <mutex>
+
+#include "KernelStats.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//       (),    .
+static std::mutex   KernelStatsMutex;
+static MKernelStats KernelStatsTotal = {};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+void KernelStatsReset()
+{
+	std::lock_guard<std::mutex> lock(KernelStatsMutex);
+
+	KernelStatsTotal = MKernelStats {};
+}
+
+void KernelStatsAdd(const MKernelStats* stats)
+{
+	assert(stats);
+
+	std::lock_guard<std::mutex> lock(KernelStatsMutex);
+
+	KernelStatsTotal.vectors     += stats->vectors;
+	KernelStatsTotal.trips       += stats->trips;
+	KernelStatsTotal.laneSlots   += stats->laneSlots;
+	KernelStatsTotal.usefulLanes += stats->usefulLanes;
+
+	for (size_t st = 0; st < KERNEL_STATS_BUCKETS; st++)
+		KernelStatsTotal.exits[st] += stats->exits[st];
+}
+
+void KernelStatsGet(MKernelStats* stats)
+{
+	assert(stats);
+
+	std::lock_guard<std::mutex> lock(KernelStatsMutex);
+
+	*stats = KernelStatsTotal;
+}
+
+/**
+ * @brief   : ,   -
+ *            .
+*/
+void KernelStatsPrint()
+{
+	MKernelStats stats = {};
+	KernelStatsGet(&stats);
+
+	if (stats.trips == 0)
+	{
+		printf("Kernel loop: no counted trips (the kernel has no counters)\n");
+		return;
+	}
+
+	const unsigned long long wasted = stats.laneSlots - stats.usefulLanes;
+
+	printf("Kernel loop: %llu vector(s), %llu trip(s), %llu lane-iteration(s): %llu useful, %llu wasted (%.1lf%%)\n",
+		   stats.vectors, stats.trips, stats.laneSlots, stats.usefulLanes, wasted,
+		   100.0 * wasted / stats.laneSlots);
+
+	if (stats.vectors == 0)
+		return;
+
+	printf("Vector exits by trips:");
+
+	for (size_t st = 0; st < KERNEL_STATS_BUCKETS; st++)
+	{
+		if (stats.exits[st])
+			printf(" <%llu: %.1lf%%", 2ULL << st, 100.0 * stats.exits[st] / stats.vectors);
+	}
+
+	printf("\n");
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
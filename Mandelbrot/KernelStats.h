@@ -0,0 +1,98 @@
+#ifndef KERNEL_STATS_H_
+#define KERNEL_STATS_H_
+
+#include <stddef.h>
+
+//-----------------------------------------------------------------------
+//   :    ,   
+//    ,    ,    .
+//
+//     MANDELBROT_KERNEL_STATS.    
+//    ,    ,  
+//   ,   .
+//-----------------------------------------------------------------------
+
+//   :   k - ,    [2^k, 2^(k+1)) 
+// (  0   ,    ).
+const size_t KERNEL_STATS_BUCKETS = 32;
+
+#ifdef MANDELBROT_KERNEL_STATS
+const bool KERNEL_STATS_ENABLED = true;
+#else
+const bool KERNEL_STATS_ENABLED = false;
+#endif
+
+struct MKernelStats
+{
+	//  ( ,   )    . , 
+	//     ,   ,     .
+	unsigned long long vectors;
+	unsigned long long trips;
+
+	// -:  ( *  )   - ,  
+	//    .  -   ,      .
+	unsigned long long laneSlots;
+	unsigned long long usefulLanes;
+
+	unsigned long long exits[KERNEL_STATS_BUCKETS];
+
+	//   ;     .
+	size_t             vectorTrips;
+};
+
+void KernelStatsReset();
+
+void KernelStatsAdd(const MKernelStats* stats);
+
+void KernelStatsGet(MKernelStats* stats);
+
+void KernelStatsPrint();
+
+//      ( movemask).
+static inline size_t KernelStatsCountBits(unsigned mask)
+{
+	size_t count = 0;
+
+	for (; mask; mask &= mask - 1)
+		count++;
+
+	return count;
+}
+
+#ifdef MANDELBROT_KERNEL_STATS
+
+//    ;     KERNEL_STATS_END.
+#define KERNEL_STATS_BEGIN(stats)            MKernelStats stats = {}
+
+#define KERNEL_STATS_VECTOR_BEGIN(stats)     ((stats).vectorTrips = 0)
+
+//     width,   lanes    .
+#define KERNEL_STATS_TRIP(stats, width, lanes) \
+	((stats).trips++, (stats).vectorTrips++, (stats).laneSlots += (width), (stats).usefulLanes += (lanes))
+
+#define KERNEL_STATS_VECTOR_END(stats)       KernelStatsEndVector(&(stats))
+
+#define KERNEL_STATS_END(stats)              KernelStatsAdd(&(stats))
+
+static inline void KernelStatsEndVector(MKernelStats* stats)
+{
+	size_t bucket = 0;
+
+	while (bucket + 1 < KERNEL_STATS_BUCKETS && (stats->vectorTrips >> (bucket + 1)) != 0)
+		bucket++;
+
+	stats->vectors++;
+	stats->exits[bucket]++;
+}
+
+#else
+
+#define KERNEL_STATS_BEGIN(stats)              ((void)0)
+#define KERNEL_STATS_VECTOR_BEGIN(stats)       ((void)0)
+#define KERNEL_STATS_TRIP(stats, width, lanes) ((void)0)
+#define KERNEL_STATS_VECTOR_END(stats)         ((void)0)
+#define KERNEL_STATS_END(stats)                ((void)0)
+
+#endif
+
+#endif
\ No newline at end of file
@@ -1,13 +1,28 @@
 #include <assert.h>
-#include <emmintrin.h>
 
 #include "Mandelbrot.h"
 
 #include "TXLib.h"
 
+#include "MandelbrotRender.h"
+
+#include "ParallelRender.h"
+
+#include "IncrementalRender.h"
+
+#include "ProgressiveRender.h"
+
+#include "TileCache.h"
+
+#include "AntiAlias.h"
+
 const size_t MANDELBROT_WIDTH  = 900;
 const size_t MANDELBROT_HEIGHT = 600;
 
+//       : FPS ,    , -
+//        .   - RunBenchmarkSuite (--benchmark).
+const size_t FPS_RENDER_COUNT  = 100;
+
 typedef RGBQUAD video_mem_t[MANDELBROT_HEIGHT][MANDELBROT_WIDTH];
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
@@ -25,15 +40,6 @@ struct MPixel
 	int y;
 };
 
-struct MRect
-{
-	double minX;
-	double maxX;
-
-	double minY;
-	double maxY;
-};
-
 static MRect screen =
 {
 	0,
@@ -55,13 +61,17 @@ static MRect map0 =
 
 static bool ReadKeyboard();
 
+static bool IsNavigationKeyPressed(void* context);
+
 static double GetWidth(const MRect* rect);
 
 static double GetHeight(const MRect* rect);
 
-static void GetNextPoint(const MPoint* first, const MPoint* cur, MPoint* next);
+static MRect GetMap();
+
+static MFrame GetFrame(video_mem_t* video_mem);
 
-static size_t CalcPoint(const MPoint* point, const double maxR, const size_t iterations);
+static MRenderParams GetRenderParams(const MKernel kernel, const bool smoothColoring, const MFractal formula);
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
@@ -73,6 +83,23 @@ static double scaleStep = 1.05;
 static double moveStepX = (GetWidth(&map0))  / 100.0;
 static double moveStepY = (GetHeight(&map0)) / 100.0;
 
+static bool   interiorCheck = true;
+static bool   panReuse      = false;
+static bool   progressive   = false;
+static bool   tileCache     = false;
+static bool   smooth        = false;
+static bool   distance      = false;
+static bool   antialias     = false;
+
+static MFractal fractal     = MFRACTAL_MANDELBROT;
+
+//        ,     .
+static uint32_t iterBuffer[MANDELBROT_HEIGHT][MANDELBROT_WIDTH];
+static uint16_t fractionBuffer[MANDELBROT_HEIGHT][MANDELBROT_WIDTH];
+
+//       E.
+static float    distanceBuffer[MANDELBROT_HEIGHT][MANDELBROT_WIDTH];
+
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
 
@@ -99,9 +126,85 @@ static bool ReadKeyboard()
 	if (txGetAsyncKeyState(VK_SUBTRACT))
 		scale *= scaleStep * (txGetAsyncKeyState(VK_SHIFT)? 1.2f : 1.0);
 
+	// I/O - /       2.
+	if (txGetAsyncKeyState('I'))
+		interiorCheck = true;
+
+	if (txGetAsyncKeyState('O'))
+		interiorCheck = false;
+
+	// R/T - /     .
+	if (txGetAsyncKeyState('R'))
+		panReuse = true;
+
+	if (txGetAsyncKeyState('T'))
+		panReuse = false;
+
+	// P/L - /     .
+	if (txGetAsyncKeyState('P'))
+		progressive = true;
+
+	if (txGetAsyncKeyState('L'))
+		progressive = false;
+
+	// C/V - /     .
+	if (txGetAsyncKeyState('C'))
+		tileCache = true;
+
+	if (txGetAsyncKeyState('V'))
+		tileCache = false;
+
+	// S/D -   /  .
+	if (txGetAsyncKeyState('S'))
+		smooth = true;
+
+	if (txGetAsyncKeyState('D'))
+		smooth = false;
+
+	// E/W -     /    (  DrawOptimizedMandelbrot).
+	if (txGetAsyncKeyState('E'))
+		distance = true;
+
+	if (txGetAsyncKeyState('W'))
+		distance = false;
+
+	// A/Z - /       (  DrawOptimizedMandelbrot).
+	if (txGetAsyncKeyState('A'))
+		antialias = true;
+
+	if (txGetAsyncKeyState('Z'))
+		antialias = false;
+
+	// M/J/B/N -  , , Burning Ship, Multibrot z^3 (  DrawOptimizedMandelbrot).
+	if (txGetAsyncKeyState('M'))
+		fractal = MFRACTAL_MANDELBROT;
+
+	if (txGetAsyncKeyState('J'))
+		fractal = MFRACTAL_JULIA;
+
+	if (txGetAsyncKeyState('B'))
+		fractal = MFRACTAL_BURNING_SHIP;
+
+	if (txGetAsyncKeyState('N'))
+		fractal = MFRACTAL_MULTIBROT;
+
 	return true;
 }
 
+/**
+ * @brief   ,    , 
+ *        ,        .
+*/
+static bool IsNavigationKeyPressed(void* context)
+{
+	(void)context;
+
+	return txGetAsyncKeyState(VK_ESCAPE) ||
+		   txGetAsyncKeyState(VK_RIGHT)  || txGetAsyncKeyState(VK_LEFT)     ||
+		   txGetAsyncKeyState(VK_DOWN)   || txGetAsyncKeyState(VK_UP)       ||
+		   txGetAsyncKeyState(VK_ADD)    || txGetAsyncKeyState(VK_SUBTRACT);
+}
+
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
 
@@ -119,101 +222,93 @@ static double GetHeight(const MRect* rect)
 	return rect->maxY - rect->minY;
 }
 
-///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
-///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
-
-static inline void GetNextPoint(const MPoint* first, const MPoint* cur, MPoint* next)
+static MRect GetMap()
 {
-	assert(first);
-	assert(cur);
-	assert(next);
+	MRect map =
+	{
+		(map0.minX + moved.x) * scale,
+		(map0.maxX + moved.x) * scale,
 
-	double x = cur->x;
-	double y = cur->y;
+		(map0.minY + moved.y) * scale,
+		(map0.maxY + moved.y) * scale
+	};
 
-	next->x = x * x - y * y + first->x;
-	next->y = 2 * x * y + first->y;
+	return map;
 }
 
-static inline size_t CalcPoint(const MPoint* point, const double maxR, const size_t iterations)
+static MFrame GetFrame(video_mem_t* video_mem)
 {
-	assert(point);
-
-	MPoint cur =
-	{
-		point->x,
-		point->y
-	};
+	assert(video_mem);
 
-	MPoint next = {0, 0};
+	MFrame frame = {};
 
-	for (size_t st = 0; st < iterations; st++)
-	{
-		GetNextPoint(point, &cur, &next);
+	frame.pixels    = &(*video_mem)[0][0];
+	frame.width     = (size_t)GetWidth(&screen);
+	frame.height    = (size_t)GetHeight(&screen);
 
-		if (next.x * next.x + next.y * next.y > maxR * maxR)
-			return st;
+	//    :    .
+	frame.stride    = (size_t)GetWidth(&screen);
+	frame.iterNums  = &iterBuffer[0][0];
+	frame.fractions = &fractionBuffer[0][0];
 
-		cur.x = next.x;
-		cur.y = next.y;
-	}
+	return frame;
+}
 
-	return iterations - 1;
+/**
+ * @brief   :     ,    -  .
+*/
+static MRenderParams GetRenderParams(const MKernel kernel, const bool smoothColoring, const MFractal formula)
+{
+	MRenderParams params = {};
+
+	params.kernel         = kernel;
+	params.maxIterations  = DEFAULT_MAX_ITERATIONS;
+	params.bailout        = DEFAULT_BAILOUT;
+	params.interiorCheck  = interiorCheck;
+	params.smoothColoring = smoothColoring;
+	params.fractal        = formula;
+	params.juliaX         = DEFAULT_JULIA_X;
+	params.juliaY         = DEFAULT_JULIA_Y;
+	params.power          = MIN_MULTIBROT_POWER;
+
+	return params;
 }
 
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
 void DrawSimpleMandelbrot(video_mem_t* video_mem)
 {
 	assert(video_mem);
 
-	const size_t imageHeight = GetHeight(&screen);
-	const size_t imageWidth  = GetWidth(&screen);
+	const MFrame frame = GetFrame(video_mem);
+
+	MThreadPool* pool = ThreadPoolCreate(0);
+
+	if (!pool)
+	{
+		printf("Cannot start the worker threads.\n");
+		return;
+	}
 
 	while(true)
 	{
 		if (!ReadKeyboard())
+		{
+			ThreadPoolDestroy(pool);
 			return;
+		}
 
-		for (size_t st = 0; st < 100; st++)
+		for (size_t st = 0; st < FPS_RENDER_COUNT; st++)
 		{
-			MRect map =
-			{
-				(map0.minX + moved.x) * scale,
-				(map0.maxX + moved.x) * scale,
-
-				(map0.minY + moved.y) * scale,
-				(map0.maxY + moved.y) * scale
-			};
-
-			double xMapStep = GetWidth(&map)  / imageWidth;
-			double yMapStep = GetHeight(&map) / imageHeight;
-
-			MPoint point = { map.minX, map.maxY };
-
-			for (size_t yIndex = 0; yIndex < imageHeight; yIndex++)
-			{
-				point.x = map.minX;
-
-				for (size_t xIndex = 0; xIndex < imageWidth; xIndex++)
-				{
-					size_t iterNum = CalcPoint(&point, 100, 256);
-
-					RGBQUAD color = RGBQUAD
-					{
-						(BYTE)(48  + 11.6341   * (iterNum)), // B
-						(BYTE)(134 + 13.1257   * (iterNum)), // G
-						(BYTE)(243 + 15.231257 * (iterNum))  // R
-					};
+			MRect map = GetMap();
 
-					(*video_mem)[yIndex][xIndex] = color;
+			MRenderParams params = GetRenderParams(MKERNEL_SIMPLE, smooth, MFRACTAL_MANDELBROT);
 
-					point.x += xMapStep;
-				}
-
-				point.y -= yMapStep;
-			}
+			RenderMandelbrotParallel(pool, &frame, &map, &params, DEFAULT_TILE_SIZE);
 		}
 
-		printf("\r%.2lf", txGetFPS() * 100);
+		printf("\r%.2lf", txGetFPS() * FPS_RENDER_COUNT);
 		txUpdateWindow();
 	}
 }
@@ -222,97 +317,94 @@ void DrawOptimizedMandelbrot(video_mem_t* video_mem)
 {
 	assert(video_mem);
 
-	const size_t imageHeight = GetHeight(&screen);
-	const size_t imageWidth  = GetWidth(&screen);
+	const MFrame frame = GetFrame(video_mem);
 
-	while (true)
-	{
-		if (!ReadKeyboard())
-			return;
+	//       :       E.
+	MFrame distanceFrame = frame;
+	distanceFrame.distances = &distanceBuffer[0][0];
 
-		for (size_t st = 0; st < 100; st++)
-		{
-			double minX     = (map0.minX + moved.x) * scale;
-			double maxX     = (map0.maxX + moved.x) * scale;
+	//      :   double   double-double.
+	const MRect startMap = GetMap();
 
-			double minY     = (map0.minY + moved.y) * scale;
-			double maxY     = (map0.maxY + moved.y) * scale;
+	printf("%s\n", GetKernelName(GetDoubleKernel(&frame, &startMap)));
 
-			double xMapStep = (maxX - minX) / imageWidth;
-			double x2MapStep = 2 * xMapStep;
-			double yMapStep = (maxY - minY) / imageHeight;
+	MThreadPool* pool = ThreadPoolCreate(0);
 
-			__m128d pointX = _mm_setzero_pd();
-			__m128d pointY = _mm_set_pd(maxY, maxY);
-			__m128d maxR   = _mm_set_pd(100, 100);
+	if (!pool)
+	{
+		printf("Cannot start the worker threads.\n");
+		return;
+	}
 
-			for (size_t yIndex = 0; yIndex < imageHeight; yIndex++)
-			{
-				pointX = _mm_set_pd(minX, minX + xMapStep);
+	MIncrementalRender incremental = {};
 
-				for (size_t xIndex = 0; xIndex < imageWidth; xIndex += 2)
-				{
-					__m128d curX    = pointX;
-					__m128d curY    = pointY;
+	IncrementalRenderReset(&incremental);
 
-					__m128i iterNum = _mm_set_epi64x(0, 0);
+	MTileCache* cache = TileCacheCreate(DEFAULT_TILE_CACHE_BUDGET, nullptr);
 
-					for (size_t st = 0; st < 255; st++)
-					{
-						__m128d nextX =
-							_mm_add_pd(
-								_mm_sub_pd(
-									_mm_mul_pd(curX, curX),
-									_mm_mul_pd(curY, curY)),
-								pointX);
+	while (true)
+	{
+		if (!ReadKeyboard())
+		{
+			TileCacheDestroy(cache);
+			ThreadPoolDestroy(pool);
+			return;
+		}
 
-						__m128d nextY =
-							_mm_add_pd(
-								_mm_mul_pd(
-									_mm_set_pd(2, 2),
-									_mm_mul_pd(curX, curY)),
-								pointY);
+		//       ,  -    z^2.
+		const bool    estimate = distance && fractal == MFRACTAL_MANDELBROT;
+		const bool    smoothed = smooth   && fractal != MFRACTAL_MULTIBROT;
 
-						__m128d r2 =
-							_mm_add_pd(
-								_mm_mul_pd(nextX, nextX),
-								_mm_mul_pd(nextY, nextY));
+		const MFrame* shown  = estimate ? &distanceFrame : &frame;
+		const MKernel kernel = estimate ? GetDistanceKernel(&frame) : MKERNEL_DOUBLE;
 
-						__m128d cmpRes = _mm_cmple_pd(r2, maxR);
+		//        ,      .
+		//       ,    
+		//      .
+		if (tileCache && !estimate && fractal == MFRACTAL_MANDELBROT)
+		{
+			MRect map = GetMap();
 
-						if (_mm_movemask_pd(cmpRes) == 0)
-							break; //     
+			MRenderParams params = GetRenderParams(MKERNEL_DOUBLE, smooth, MFRACTAL_MANDELBROT);
 
-						iterNum = _mm_sub_epi64(iterNum, _mm_castpd_si128(cmpRes));
+			RenderMandelbrotCached(cache, pool, &frame, &map, &params);
 
-						curX = nextX;
-						curY = nextY;
-					}
+			IncrementalRenderReset(&incremental);
 
-					long long* ptr_iterNum = (long long*)&iterNum;
+			printf("\r%.2lf", txGetFPS());
+			txUpdateWindow();
+			continue;
+		}
 
-					for (size_t st = 0; st < 2; st++)
-					{
-						BYTE iters = (BYTE)ptr_iterNum[1 - st];
+		//        ,     .
+		if (panReuse)
+		{
+			MRect map = GetMap();
 
-						RGBQUAD color = RGBQUAD
-						{
-							(BYTE)(48  + 11.6341   * (iters)), // B
-							(BYTE)(134 + 13.1257   * (iters)), // G
-							(BYTE)(243 + 15.2312   * (iters))  // R
-						};
+			MRenderParams params = GetRenderParams(kernel, smoothed, fractal);
 
-						(*video_mem)[yIndex][xIndex + st] = color;
-					}
+			RenderMandelbrotIncremental(&incremental, pool, shown, &map, &params, DEFAULT_TILE_SIZE);
 
-					pointX = _mm_add_pd(pointX, _mm_set_pd(x2MapStep, x2MapStep));
-				}
+			printf("\r%.2lf", txGetFPS());
+			txUpdateWindow();
+			continue;
+		}
+
+		IncrementalRenderReset(&incremental);
 
-				pointY = _mm_sub_pd(pointY, _mm_set_pd(yMapStep, yMapStep));
-			}
+		for (size_t st = 0; st < FPS_RENDER_COUNT; st++)
+		{
+			MRect map = GetMap();
+
+			MRenderParams params = GetRenderParams(kernel, smoothed, fractal);
+
+			//   ,  ,      double   .
+			if (!antialias ||
+				!RenderMandelbrotAntiAliased(pool, shown, &map, &params, DEFAULT_TILE_SIZE, DEFAULT_ANTIALIAS_GRID, nullptr))
+				RenderMandelbrotParallel(pool, shown, &map, &params, DEFAULT_TILE_SIZE);
 		}
 
-		printf("\r%.2lf", txGetFPS() * 100);
+		printf("\r%.2lf", txGetFPS() * FPS_RENDER_COUNT);
 		txUpdateWindow();
 	}
 }
@@ -321,97 +413,55 @@ void DrawOptimizedFloatMandelbrot(video_mem_t* video_mem)
 {
 	assert(video_mem);
 
-	const size_t imageHeight = GetHeight(&screen);
-	const size_t imageWidth  = GetWidth(&screen);
+	const MFrame frame = GetFrame(video_mem);
+
+	MThreadPool* pool = ThreadPoolCreate(0);
+
+	if (!pool)
+	{
+		printf("Cannot start the worker threads.\n");
+		return;
+	}
+
+	MProgressiveRender progressiveState = {};
+
+	ProgressiveRenderReset(&progressiveState);
 
 	while (true)
 	{
 		if (!ReadKeyboard())
+		{
+			ThreadPoolDestroy(pool);
 			return;
+		}
 
-		//for (size_t st = 0; st < 100; st++)
+		//    ,     ,      .
+		if (progressive)
 		{
-			double minX     = (map0.minX + moved.x) * scale;
-			double maxX     = (map0.maxX + moved.x) * scale;
-			
-			double minY     = (map0.minY + moved.y) * scale;
-			double maxY     = (map0.maxY + moved.y) * scale;
-
-			double xMapStep = (maxX - minX) / imageWidth;
-			double x4MapStep = 4 * xMapStep;
-			double yMapStep = (maxY - minY) / imageHeight;
-
-			__m128 pointX = _mm_setzero_ps();
-			__m128 pointY = _mm_set_ps1(maxY);
-			__m128 maxR   = _mm_set_ps1(100);
-
-			for (size_t yIndex = 0; yIndex < imageHeight; yIndex++)
-			{
-				pointX = _mm_set_ps(minX, minX + xMapStep, minX + 2 * xMapStep, minX + 3 * xMapStep);
-
-				for (size_t xIndex = 0; xIndex < imageWidth; xIndex += 4)
-				{
-					__m128 curX     = pointX;
-					__m128 curY     = pointY;
-
-					__m128i iterNum = _mm_set1_epi32(0);
-
-					for (size_t st = 0; st < 255; st++)
-					{
-						__m128 nextX =
-							_mm_add_ps(
-								_mm_sub_ps(
-									_mm_mul_ps(curX, curX),
-									_mm_mul_ps(curY, curY)),
-								pointX);
-
-						__m128 nextY =
-							_mm_add_ps(
-								_mm_mul_ps(
-									_mm_set_ps1(2),
-									_mm_mul_ps(curX, curY)),
-								pointY);
-
-						__m128 r2 =
-							_mm_add_ps(
-								_mm_mul_ps(nextX, nextX),
-								_mm_mul_ps(nextY, nextY));
-
-						__m128 cmpRes = _mm_cmple_ps(r2, maxR);
-
-						if (_mm_movemask_ps(cmpRes) == 0)
-							break; //     
-
-						iterNum = _mm_sub_epi32(iterNum, _mm_castps_si128(cmpRes));
-
-						curX = nextX;
-						curY = nextY;
-					}
-
-					int* ptr_iterNum = (int*)&iterNum;
-
-					for (size_t st = 0; st < 4; st++)
-					{
-						BYTE iters = (BYTE)ptr_iterNum[3 - st];
-
-						RGBQUAD color = RGBQUAD
-						{
-							(BYTE)(48  + 11.6341   * (iters)), // B
-							(BYTE)(134 + 13.1257   * (iters)), // G
-							(BYTE)(243 + 15.2312   * (iters))  // R
-						};
-
-						(*video_mem)[yIndex][xIndex + st] = color;
-					}
-
-					pointX = _mm_add_ps(pointX, _mm_set_ps1(x4MapStep));
-				}
-
-				pointY = _mm_sub_ps(pointY, _mm_set_ps1(yMapStep));
-			}
+			MRect map = GetMap();
+
+			MRenderParams params = GetRenderParams(MKERNEL_FLOAT_SSE, smooth, MFRACTAL_MANDELBROT);
+
+			RenderMandelbrotProgressive(&progressiveState, pool, &frame, &map, &params, DEFAULT_TILE_SIZE,
+										IsNavigationKeyPressed, nullptr);
+
+			printf("\r%.2lf", txGetFPS());
+			txUpdateWindow();
+			continue;
+		}
+
+		ProgressiveRenderReset(&progressiveState);
+
+		for (size_t st = 0; st < FPS_RENDER_COUNT; st++)
+		{
+			MRect map = GetMap();
+
+			MRenderParams params = GetRenderParams(MKERNEL_FLOAT_SSE, smooth, MFRACTAL_MANDELBROT);
+
+			RenderMandelbrotParallel(pool, &frame, &map, &params, DEFAULT_TILE_SIZE);
 		}
 
-		printf("\r%.2lf", txGetFPS() * 100);
+		printf("\r%.2lf", txGetFPS() * FPS_RENDER_COUNT);
 		txUpdateWindow();
 	}
 }
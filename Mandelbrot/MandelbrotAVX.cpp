@@ -0,0 +1,338 @@
+#include <assert.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include "MandelbrotRender.h"
+
+#include "CpuFeatures.h"
+#include "FractalKernel.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+TARGET_AVX2_FLATTEN
+static __m256d IsInteriorAVX2(const __m256d pointX, const __m256d pointY);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief        2 (. IsInteriorPoint)  4 .
+*/
+TARGET_AVX2_FLATTEN
+static inline __m256d IsInteriorAVX2(const __m256d pointX, const __m256d pointY)
+{
+	__m256d interior;
+	MMandelbrotFormula::IsInterior<MAVX2Ops>(pointX, pointY, &interior);
+
+	return interior;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief  ,   RenderSSEMandelbrot,  4  double   (AVX2 + FMA).
+ *           GetCpuFeatures()    AVX2  FMA.
+*/
+TARGET_AVX2_FLATTEN
+void RenderAVX2Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+						  const MIterTile* iterTile)
+{
+	RenderFormulaTile<MMandelbrotFormula, MAVX2Ops>(frame, map, params, tile, iterTile);
+}
+
+/**
+ * @brief     RenderDistanceSSEMandelbrot,  4     FMA;
+ *            RenderAVX2Mandelbrot.
+*/
+TARGET_AVX2
+void RenderDistanceAVX2Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								  const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(iterTile->distances);
+	assert(map);
+	assert(params);
+	assert(tile);
+	assert(tile->width % 4 == 0);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double minX     = map->minX;
+	double maxX     = map->maxX;
+
+	double minY     = map->minY;
+	double maxY     = map->maxY;
+
+	double xMapStep = (maxX - minX) / imageWidth;
+	double yMapStep = (maxY - minY) / imageHeight;
+
+	const __m256d laneIndex = _mm256_set_pd(3, 2, 1, 0);
+	const __m256i packLow   = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+	__m256d pointX = _mm256_setzero_pd();
+	__m256d pointY = _mm256_setzero_pd();
+	__m256d maxR2  = _mm256_set1_pd(params->bailout * params->bailout);
+
+	const __m256d one = _mm256_set1_pd(1);
+
+	const size_t  maxIterations = params->maxIterations;
+	const __m256i maxIters      = _mm256_set1_epi64x((long long)maxIterations);
+
+	const __m256d signMask  = _mm256_set1_pd(-0.0);
+	const __m256d periodEps = _mm256_set1_pd(1e-12);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		uint32_t* row       = iterTile->iterNums  + (yIndex - tile->y0) * iterTile->stride;
+		float*    distances = iterTile->distances + (yIndex - tile->y0) * iterTile->stride;
+
+		pointY = _mm256_set1_pd(fma(-(double)yIndex, yMapStep, maxY));
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex += 4)
+		{
+			pointX = _mm256_fmadd_pd(_mm256_add_pd(_mm256_set1_pd((double)xIndex), laneIndex),
+									 _mm256_set1_pd(xMapStep), _mm256_set1_pd(minX));
+
+			__m256d curX     = pointX;
+			__m256d curY     = pointY;
+
+			__m256d derX     = one;
+			__m256d derY     = _mm256_setzero_pd();
+
+			__m256i iterNum  = _mm256_setzero_si256();
+
+			__m256d interior = _mm256_setzero_pd();
+
+			if (params->interiorCheck)
+			{
+				interior = IsInteriorAVX2(pointX, pointY);
+				iterNum  = _mm256_and_si256(_mm256_castpd_si256(interior), maxIters);
+			}
+
+			__m256d savedX     = curX;
+			__m256d savedY     = curY;
+			size_t  checkpoint = 8;
+
+			__m256d escapeR2   = _mm256_setzero_pd();
+			__m256d escapeDR2  = _mm256_setzero_pd();
+			__m256d active     = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+			KERNEL_STATS_VECTOR_BEGIN(stats);
+
+			for (size_t st = 0; st < maxIterations; st++)
+			{
+				__m256d nextX =
+					_mm256_fmsub_pd(curX, curX,
+						_mm256_fmsub_pd(curY, curY, pointX));
+
+				__m256d nextY =
+					_mm256_fmadd_pd(
+						_mm256_add_pd(curX, curX),
+						curY,
+						pointY);
+
+				// (x dX - y dY) * 2 + 1
+				__m256d nextDerX =
+					_mm256_fmadd_pd(
+						_mm256_fmsub_pd(curX, derX, _mm256_mul_pd(curY, derY)),
+						_mm256_set1_pd(2),
+						one);
+
+				// (x + x) * dY + (y + y) * dX
+				__m256d nextDerY =
+					_mm256_fmadd_pd(
+						_mm256_add_pd(curX, curX),
+						derY,
+						_mm256_mul_pd(_mm256_add_pd(curY, curY), derX));
+
+				__m256d r2 =
+					_mm256_fmadd_pd(nextX, nextX,
+						_mm256_mul_pd(nextY, nextY));
+
+				__m256d dr2 =
+					_mm256_fmadd_pd(nextDerX, nextDerX,
+						_mm256_mul_pd(nextDerY, nextDerY));
+
+				__m256d cmpRes = _mm256_andnot_pd(interior, _mm256_cmp_pd(r2, maxR2, _CMP_LE_OQ));
+
+				KERNEL_STATS_TRIP(stats, 4, KernelStatsCountBits(_mm256_movemask_pd(cmpRes)));
+
+				escapeR2  = _mm256_blendv_pd(escapeR2,  r2,  active);
+				escapeDR2 = _mm256_blendv_pd(escapeDR2, dr2, active);
+
+				if (_mm256_movemask_pd(cmpRes) == 0)
+					break; //     
+
+				active = cmpRes;
+
+				iterNum = _mm256_sub_epi64(iterNum, _mm256_castpd_si256(cmpRes));
+
+				curX = nextX;
+				curY = nextY;
+				derX = nextDerX;
+				derY = nextDerY;
+
+				//     RenderSSEMandelbrot.
+				if (params->periodCheck && (st & 7) == 0)
+				{
+					__m256d cycle =
+						_mm256_and_pd(cmpRes,
+							_mm256_and_pd(
+								_mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(curX, savedX)), periodEps, _CMP_LT_OQ),
+								_mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(curY, savedY)), periodEps, _CMP_LT_OQ)));
+
+					interior = _mm256_or_pd(interior, cycle);
+					iterNum  = _mm256_blendv_epi8(iterNum, maxIters, _mm256_castpd_si256(cycle));
+
+					if (st == checkpoint)
+					{
+						savedX      = curX;
+						savedY      = curY;
+						checkpoint *= 2;
+					}
+				}
+			}
+
+			KERNEL_STATS_VECTOR_END(stats);
+
+			_mm_storeu_si128((__m128i*)(row + xIndex - tile->x0),
+							 _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(iterNum, packLow)));
+
+			__m256d ratio = _mm256_and_pd(_mm256_cmp_pd(escapeR2, maxR2, _CMP_GT_OQ),
+										  _mm256_div_pd(escapeR2, escapeDR2));
+
+			alignas(16) float escapeR2f[4] = {};
+			alignas(16) float ratiof[4]    = {};
+			_mm_store_ps(escapeR2f, _mm256_cvtpd_ps(escapeR2));
+			_mm_store_ps(ratiof,    _mm256_cvtpd_ps(ratio));
+
+			GetDistanceEstimates(escapeR2f, ratiof, 4, xMapStep, distances + xIndex - tile->x0);
+		}
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+/**
+ * @brief  ,   RenderAVX2Mandelbrot,  8  double   (AVX-512F).
+ *         -    __mmask8.
+*/
+TARGET_AVX512_FLATTEN
+void RenderAVX512Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							const MIterTile* iterTile)
+{
+	RenderFormulaTile<MMandelbrotFormula, MAVX512Ops>(frame, map, params, tile, iterTile);
+}
+
+/**
+ * @brief  ,   CalcPointsSSE,  4    (AVX2 + FMA),    RenderAVX2Mandelbrot.
+ *              .
+*/
+TARGET_AVX2
+void CalcPointsAVX2(const double* pointsX, const double* pointsY, const size_t count,
+					const MRenderParams* params, uint32_t* iterNums)
+{
+	assert(pointsX);
+	assert(pointsY);
+	assert(params);
+	assert(iterNums);
+
+	__m256d maxR2 = _mm256_set1_pd(params->bailout * params->bailout);
+
+	const size_t  maxIterations = params->maxIterations;
+	const __m256i maxIters      = _mm256_set1_epi64x((long long)maxIterations);
+
+	const __m256d signMask  = _mm256_set1_pd(-0.0);
+	const __m256d periodEps = _mm256_set1_pd(1e-12);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t index = 0; index < count; index += 4)
+	{
+		size_t lanes[4] = {};
+
+		for (size_t lane = 0; lane < 4; lane++)
+			lanes[lane] = index + lane < count ? index + lane : count - 1;
+
+		__m256d pointX   = _mm256_set_pd(pointsX[lanes[3]], pointsX[lanes[2]], pointsX[lanes[1]], pointsX[lanes[0]]);
+		__m256d pointY   = _mm256_set_pd(pointsY[lanes[3]], pointsY[lanes[2]], pointsY[lanes[1]], pointsY[lanes[0]]);
+
+		__m256d curX     = pointX;
+		__m256d curY     = pointY;
+
+		__m256i iterNum  = _mm256_setzero_si256();
+
+		__m256d interior = _mm256_setzero_pd();
+
+		if (params->interiorCheck)
+		{
+			interior = IsInteriorAVX2(pointX, pointY);
+			iterNum  = _mm256_and_si256(_mm256_castpd_si256(interior), maxIters);
+		}
+
+		__m256d savedX     = curX;
+		__m256d savedY     = curY;
+		size_t  checkpoint = 8;
+
+		KERNEL_STATS_VECTOR_BEGIN(stats);
+
+		for (size_t st = 0; st < maxIterations; st++)
+		{
+			__m256d nextX = _mm256_fmsub_pd(curX, curX, _mm256_fmsub_pd(curY, curY, pointX));
+			__m256d nextY = _mm256_fmadd_pd(_mm256_add_pd(curX, curX), curY, pointY);
+
+			__m256d r2 = _mm256_fmadd_pd(nextX, nextX, _mm256_mul_pd(nextY, nextY));
+
+			__m256d cmpRes = _mm256_andnot_pd(interior, _mm256_cmp_pd(r2, maxR2, _CMP_LE_OQ));
+
+			KERNEL_STATS_TRIP(stats, 4, KernelStatsCountBits(_mm256_movemask_pd(cmpRes)));
+
+			if (_mm256_movemask_pd(cmpRes) == 0)
+				break; //     
+
+			iterNum = _mm256_sub_epi64(iterNum, _mm256_castpd_si256(cmpRes));
+
+			curX = nextX;
+			curY = nextY;
+
+			if (params->periodCheck && (st & 7) == 0)
+			{
+				__m256d cycle =
+					_mm256_and_pd(cmpRes,
+						_mm256_and_pd(
+							_mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(curX, savedX)), periodEps, _CMP_LT_OQ),
+							_mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(curY, savedY)), periodEps, _CMP_LT_OQ)));
+
+				interior = _mm256_or_pd(interior, cycle);
+				iterNum  = _mm256_blendv_epi8(iterNum, maxIters, _mm256_castpd_si256(cycle));
+
+				if (st == checkpoint)
+				{
+					savedX      = curX;
+					savedY      = curY;
+					checkpoint *= 2;
+				}
+			}
+		}
+
+		KERNEL_STATS_VECTOR_END(stats);
+
+		alignas(32) long long ptr_iterNum[4] = {};
+		_mm256_store_si256((__m256i*)ptr_iterNum, iterNum);
+
+		for (size_t lane = 0; lane < 4; lane++)
+			iterNums[lanes[lane]] = (uint32_t)ptr_iterNum[lane];
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
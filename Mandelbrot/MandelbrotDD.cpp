@@ -0,0 +1,586 @@
+#include <assert.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include "MandelbrotRender.h"
+
+#include "CpuFeatures.h"
+#include "KernelStats.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//-----------------------------------------------------------------------
+//  double-double -   hi + lo, |lo| <= ulp(hi) / 2:
+// 106     double.      hi.
+//-----------------------------------------------------------------------
+
+struct MDD128
+{
+	__m128d hi;
+	__m128d lo;
+};
+
+struct MDD256
+{
+	__m256d hi;
+	__m256d lo;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static MDD128 QuickTwoSumSSE(const __m128d a, const __m128d b);
+
+static MDD128 TwoSumSSE(const __m128d a, const __m128d b);
+
+static MDD128 TwoProdSSE(const __m128d a, const __m128d b);
+
+static MDD128 DDAddSSE(const MDD128 a, const MDD128 b);
+
+static MDD128 DDNegSSE(const MDD128 a);
+
+static MDD128 DDMulSSE(const MDD128 a, const MDD128 b);
+
+static MDD128 DDScaleSSE(const MDD128 a, const double factor);
+
+static __m128d IsInteriorDDSSE(const MDD128 pointX, const MDD128 pointY);
+
+TARGET_AVX2
+static MDD256 QuickTwoSumAVX2(const __m256d a, const __m256d b);
+
+TARGET_AVX2
+static MDD256 TwoSumAVX2(const __m256d a, const __m256d b);
+
+TARGET_AVX2
+static MDD256 TwoProdAVX2(const __m256d a, const __m256d b);
+
+TARGET_AVX2
+static MDD256 DDAddAVX2(const MDD256 a, const MDD256 b);
+
+TARGET_AVX2
+static MDD256 DDNegAVX2(const MDD256 a);
+
+TARGET_AVX2
+static MDD256 DDMulAVX2(const MDD256 a, const MDD256 b);
+
+TARGET_AVX2
+static MDD256 DDScaleAVX2(const MDD256 a, const double factor);
+
+TARGET_AVX2
+static __m256d IsInteriorDDAVX2(const MDD256 pointX, const MDD256 pointY);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief a + b    ,  |a| >= |b|.
+*/
+static inline MDD128 QuickTwoSumSSE(const __m128d a, const __m128d b)
+{
+	__m128d sum = _mm_add_pd(a, b);
+	__m128d err = _mm_sub_pd(b, _mm_sub_pd(sum, a));
+
+	return MDD128 { sum, err };
+}
+
+/**
+ * @brief a + b     ( ).
+*/
+static inline MDD128 TwoSumSSE(const __m128d a, const __m128d b)
+{
+	__m128d sum  = _mm_add_pd(a, b);
+	__m128d bVir = _mm_sub_pd(sum, a);
+	__m128d err  = _mm_add_pd(_mm_sub_pd(a, _mm_sub_pd(sum, bVir)), _mm_sub_pd(b, bVir));
+
+	return MDD128 { sum, err };
+}
+
+/**
+ * @brief   a * b.  SSE2  FMA,   
+ *           26  ( ),   .
+*/
+static inline MDD128 TwoProdSSE(const __m128d a, const __m128d b)
+{
+	const __m128d splitter = _mm_set1_pd(134217729.0); // 2^27 + 1
+
+	__m128d aTmp = _mm_mul_pd(splitter, a);
+	__m128d aHi  = _mm_sub_pd(aTmp, _mm_sub_pd(aTmp, a));
+	__m128d aLo  = _mm_sub_pd(a, aHi);
+
+	__m128d bTmp = _mm_mul_pd(splitter, b);
+	__m128d bHi  = _mm_sub_pd(bTmp, _mm_sub_pd(bTmp, b));
+	__m128d bLo  = _mm_sub_pd(b, bHi);
+
+	__m128d prod = _mm_mul_pd(a, b);
+
+	__m128d err =
+		_mm_add_pd(
+			_mm_add_pd(
+				_mm_add_pd(_mm_sub_pd(_mm_mul_pd(aHi, bHi), prod), _mm_mul_pd(aHi, bLo)),
+				_mm_mul_pd(aLo, bHi)),
+			_mm_mul_pd(aLo, bLo));
+
+	return MDD128 { prod, err };
+}
+
+/**
+ * @brief  double-double.   |a| + |b|,   ,
+ *             : |z|   .
+*/
+static inline MDD128 DDAddSSE(const MDD128 a, const MDD128 b)
+{
+	MDD128 sum = TwoSumSSE(a.hi, b.hi);
+
+	return QuickTwoSumSSE(sum.hi, _mm_add_pd(sum.lo, _mm_add_pd(a.lo, b.lo)));
+}
+
+static inline MDD128 DDNegSSE(const MDD128 a)
+{
+	const __m128d signMask = _mm_set1_pd(-0.0);
+
+	return MDD128 { _mm_xor_pd(a.hi, signMask), _mm_xor_pd(a.lo, signMask) };
+}
+
+static inline MDD128 DDMulSSE(const MDD128 a, const MDD128 b)
+{
+	MDD128 prod = TwoProdSSE(a.hi, b.hi);
+
+	__m128d cross = _mm_add_pd(_mm_mul_pd(a.hi, b.lo), _mm_mul_pd(a.lo, b.hi));
+
+	return QuickTwoSumSSE(prod.hi, _mm_add_pd(prod.lo, cross));
+}
+
+/**
+ * @brief     -    .
+*/
+static inline MDD128 DDScaleSSE(const MDD128 a, const double factor)
+{
+	const __m128d scale = _mm_set1_pd(factor);
+
+	return MDD128 { _mm_mul_pd(a.hi, scale), _mm_mul_pd(a.lo, scale) };
+}
+
+/**
+ * @brief        2 (. IsInteriorPoint)  double-double:
+ *         double     ,    ,
+ *         .
+*/
+static inline __m128d IsInteriorDDSSE(const MDD128 pointX, const MDD128 pointY)
+{
+	const __m128d zero = _mm_setzero_pd();
+
+	MDD128 x  = DDAddSSE(pointX, MDD128 { _mm_set1_pd(-0.25), zero });
+	MDD128 y2 = DDMulSSE(pointY, pointY);
+	MDD128 q  = DDAddSSE(DDMulSSE(x, x), y2);
+
+	MDD128 cardioid = DDAddSSE(DDMulSSE(q, DDAddSSE(q, x)), DDNegSSE(DDScaleSSE(y2, 0.25)));
+
+	MDD128 x1   = DDAddSSE(pointX, MDD128 { _mm_set1_pd(1), zero });
+	MDD128 bulb = DDAddSSE(DDAddSSE(DDMulSSE(x1, x1), y2), MDD128 { _mm_set1_pd(-0.0625), zero });
+
+	return _mm_or_pd(_mm_cmple_pd(cardioid.hi, zero), _mm_cmple_pd(bulb.hi, zero));
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+TARGET_AVX2
+static inline MDD256 QuickTwoSumAVX2(const __m256d a, const __m256d b)
+{
+	__m256d sum = _mm256_add_pd(a, b);
+	__m256d err = _mm256_sub_pd(b, _mm256_sub_pd(sum, a));
+
+	return MDD256 { sum, err };
+}
+
+TARGET_AVX2
+static inline MDD256 TwoSumAVX2(const __m256d a, const __m256d b)
+{
+	__m256d sum  = _mm256_add_pd(a, b);
+	__m256d bVir = _mm256_sub_pd(sum, a);
+	__m256d err  = _mm256_add_pd(_mm256_sub_pd(a, _mm256_sub_pd(sum, bVir)), _mm256_sub_pd(b, bVir));
+
+	return MDD256 { sum, err };
+}
+
+/**
+ * @brief   a * b: FMA  a * b - prod  ,   .
+*/
+TARGET_AVX2
+static inline MDD256 TwoProdAVX2(const __m256d a, const __m256d b)
+{
+	__m256d prod = _mm256_mul_pd(a, b);
+	__m256d err  = _mm256_fmsub_pd(a, b, prod);
+
+	return MDD256 { prod, err };
+}
+
+TARGET_AVX2
+static inline MDD256 DDAddAVX2(const MDD256 a, const MDD256 b)
+{
+	MDD256 sum = TwoSumAVX2(a.hi, b.hi);
+
+	return QuickTwoSumAVX2(sum.hi, _mm256_add_pd(sum.lo, _mm256_add_pd(a.lo, b.lo)));
+}
+
+TARGET_AVX2
+static inline MDD256 DDNegAVX2(const MDD256 a)
+{
+	const __m256d signMask = _mm256_set1_pd(-0.0);
+
+	return MDD256 { _mm256_xor_pd(a.hi, signMask), _mm256_xor_pd(a.lo, signMask) };
+}
+
+TARGET_AVX2
+static inline MDD256 DDMulAVX2(const MDD256 a, const MDD256 b)
+{
+	MDD256 prod = TwoProdAVX2(a.hi, b.hi);
+
+	__m256d cross = _mm256_fmadd_pd(a.hi, b.lo, _mm256_mul_pd(a.lo, b.hi));
+
+	return QuickTwoSumAVX2(prod.hi, _mm256_add_pd(prod.lo, cross));
+}
+
+TARGET_AVX2
+static inline MDD256 DDScaleAVX2(const MDD256 a, const double factor)
+{
+	const __m256d scale = _mm256_set1_pd(factor);
+
+	return MDD256 { _mm256_mul_pd(a.hi, scale), _mm256_mul_pd(a.lo, scale) };
+}
+
+TARGET_AVX2
+static inline __m256d IsInteriorDDAVX2(const MDD256 pointX, const MDD256 pointY)
+{
+	const __m256d zero = _mm256_setzero_pd();
+
+	MDD256 x  = DDAddAVX2(pointX, MDD256 { _mm256_set1_pd(-0.25), zero });
+	MDD256 y2 = DDMulAVX2(pointY, pointY);
+	MDD256 q  = DDAddAVX2(DDMulAVX2(x, x), y2);
+
+	MDD256 cardioid = DDAddAVX2(DDMulAVX2(q, DDAddAVX2(q, x)), DDNegAVX2(DDScaleAVX2(y2, 0.25)));
+
+	MDD256 x1   = DDAddAVX2(pointX, MDD256 { _mm256_set1_pd(1), zero });
+	MDD256 bulb = DDAddAVX2(DDAddAVX2(DDMulAVX2(x1, x1), y2), MDD256 { _mm256_set1_pd(-0.0625), zero });
+
+	return _mm256_or_pd(_mm256_cmp_pd(cardioid.hi, zero, _CMP_LE_OQ), _mm256_cmp_pd(bulb.hi, zero, _CMP_LE_OQ));
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief  ,   RenderSSEMandelbrot,     - double-double (106 ),  2 .
+ *          minX + i * xMapStep   (TwoProd),  
+ *         ,     ulp(minX).   
+ *          : 1e-12   .
+ *          10   double,  ,  
+ *        double   (. GetDoubleKernel).
+*/
+void RenderDDSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+						   const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(map);
+	assert(params);
+	assert(tile);
+	assert(tile->width % 2 == 0);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double minX     = map->minX;
+	double maxX     = map->maxX;
+
+	double minY     = map->minY;
+	double maxY     = map->maxY;
+
+	double xMapStep = (maxX - minX) / imageWidth;
+	double yMapStep = (maxY - minY) / imageHeight;
+
+	//    RenderSSEMandelbrot       .
+	const __m128d laneIndex = _mm_set_pd(1, 0);
+
+	const __m128d zero      = _mm_setzero_pd();
+	const __m128d maxR2     = _mm_set1_pd(params->bailout * params->bailout);
+
+	const size_t  maxIterations = params->maxIterations;
+	const __m128i maxIters      = _mm_set1_epi64x((long long)maxIterations);
+
+	const __m128d signMask  = _mm_set1_pd(-0.0);
+	const __m128d periodEps = _mm_set1_pd(1e-3 * fmin(xMapStep, yMapStep));
+
+	const bool  smooth      = iterTile->fractions != nullptr;
+	const float smoothScale = GetSmoothScale(params);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		uint32_t* row       = iterTile->iterNums + (yIndex - tile->y0) * iterTile->stride;
+		uint16_t* fractions = smooth ? iterTile->fractions + (yIndex - tile->y0) * iterTile->stride : nullptr;
+
+		// maxY - yIndex * yMapStep
+		MDD128 pointY = DDAddSSE(MDD128 { _mm_set1_pd(maxY), zero },
+								 TwoProdSSE(_mm_set1_pd(-(double)yIndex), _mm_set1_pd(yMapStep)));
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex += 2)
+		{
+			// minX + (xIndex + lane) * xMapStep
+			MDD128 pointX = DDAddSSE(MDD128 { _mm_set1_pd(minX), zero },
+									 TwoProdSSE(_mm_add_pd(_mm_set1_pd((double)xIndex), laneIndex),
+												_mm_set1_pd(xMapStep)));
+
+			MDD128  curX     = pointX;
+			MDD128  curY     = pointY;
+
+			__m128i iterNum  = _mm_setzero_si128();
+
+			__m128d interior = _mm_setzero_pd();
+
+			if (params->interiorCheck)
+			{
+				interior = IsInteriorDDSSE(pointX, pointY);
+				iterNum  = _mm_and_si128(_mm_castpd_si128(interior), maxIters);
+			}
+
+			MDD128  savedX     = curX;
+			MDD128  savedY     = curY;
+			//    ,    ,  8.
+			size_t  checkpoint = 8;
+
+			// |z|^2   ,   RenderSSEMandelbrot;     .
+			__m128d escapeR2   = _mm_setzero_pd();
+			__m128d active     = _mm_castsi128_pd(_mm_set1_epi64x(-1));
+
+			KERNEL_STATS_VECTOR_BEGIN(stats);
+
+			for (size_t st = 0; st < maxIterations; st++)
+			{
+				MDD128 x2 = DDMulSSE(curX, curX);
+				MDD128 y2 = DDMulSSE(curY, curY);
+				MDD128 xy = DDMulSSE(curX, curY);
+
+				// x^2 - y^2 + x0
+				MDD128 nextX = DDAddSSE(DDAddSSE(x2, DDNegSSE(y2)), pointX);
+
+				// 2xy + y0
+				MDD128 nextY = DDAddSSE(DDScaleSSE(xy, 2), pointY);
+
+				//       .
+				__m128d r2 = _mm_add_pd(_mm_mul_pd(nextX.hi, nextX.hi), _mm_mul_pd(nextY.hi, nextY.hi));
+
+				__m128d cmpRes = _mm_andnot_pd(interior, _mm_cmple_pd(r2, maxR2));
+
+				KERNEL_STATS_TRIP(stats, 2, KernelStatsCountBits(_mm_movemask_pd(cmpRes)));
+
+				if (smooth)
+					escapeR2 = _mm_max_pd(escapeR2, _mm_and_pd(active, r2));
+
+				if (_mm_movemask_pd(cmpRes) == 0)
+					break; //     
+
+				active = cmpRes;
+
+				iterNum = _mm_sub_epi64(iterNum, _mm_castpd_si128(cmpRes));
+
+				curX = nextX;
+				curY = nextY;
+
+				if (params->periodCheck && (st & 7) == 0)
+				{
+					MDD128 diffX = DDAddSSE(curX, DDNegSSE(savedX));
+					MDD128 diffY = DDAddSSE(curY, DDNegSSE(savedY));
+
+					__m128d cycle =
+						_mm_and_pd(cmpRes,
+							_mm_and_pd(
+								_mm_cmplt_pd(_mm_andnot_pd(signMask, diffX.hi), periodEps),
+								_mm_cmplt_pd(_mm_andnot_pd(signMask, diffY.hi), periodEps)));
+
+					interior = _mm_or_pd(interior, cycle);
+					iterNum  = _mm_or_si128(_mm_andnot_si128(_mm_castpd_si128(cycle), iterNum),
+											_mm_and_si128(_mm_castpd_si128(cycle), maxIters));
+
+					if (st == checkpoint)
+					{
+						savedX      = curX;
+						savedY      = curY;
+						checkpoint *= 2;
+					}
+				}
+			}
+
+			KERNEL_STATS_VECTOR_END(stats);
+
+			_mm_storel_epi64((__m128i*)(row + xIndex - tile->x0), _mm_shuffle_epi32(iterNum, _MM_SHUFFLE(3, 1, 2, 0)));
+
+			if (smooth)
+			{
+				alignas(16) float escapeR2f[4] = {};
+				_mm_store_ps(escapeR2f, _mm_cvtpd_ps(escapeR2));
+
+				GetSmoothFractions(escapeR2f, 2, smoothScale, fractions + xIndex - tile->x0);
+			}
+		}
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+/**
+ * @brief  ,   RenderDDSSEMandelbrot,  4    (AVX2 + FMA).
+ *         FMA    2   17.
+*/
+TARGET_AVX2
+void RenderDDAVX2Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(map);
+	assert(params);
+	assert(tile);
+	assert(tile->width % 4 == 0);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double minX     = map->minX;
+	double maxX     = map->maxX;
+
+	double minY     = map->minY;
+	double maxY     = map->maxY;
+
+	double xMapStep = (maxX - minX) / imageWidth;
+	double yMapStep = (maxY - minY) / imageHeight;
+
+	const __m256d laneIndex = _mm256_set_pd(3, 2, 1, 0);
+
+	const __m256i packLow   = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+	const __m256d zero      = _mm256_setzero_pd();
+	const __m256d maxR2     = _mm256_set1_pd(params->bailout * params->bailout);
+
+	const size_t  maxIterations = params->maxIterations;
+	const __m256i maxIters      = _mm256_set1_epi64x((long long)maxIterations);
+
+	const __m256d signMask  = _mm256_set1_pd(-0.0);
+	const __m256d periodEps = _mm256_set1_pd(1e-3 * fmin(xMapStep, yMapStep));
+
+	const bool  smooth      = iterTile->fractions != nullptr;
+	const float smoothScale = GetSmoothScale(params);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		uint32_t* row       = iterTile->iterNums + (yIndex - tile->y0) * iterTile->stride;
+		uint16_t* fractions = smooth ? iterTile->fractions + (yIndex - tile->y0) * iterTile->stride : nullptr;
+
+		MDD256 pointY = DDAddAVX2(MDD256 { _mm256_set1_pd(maxY), zero },
+								  TwoProdAVX2(_mm256_set1_pd(-(double)yIndex), _mm256_set1_pd(yMapStep)));
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex += 4)
+		{
+			MDD256 pointX = DDAddAVX2(MDD256 { _mm256_set1_pd(minX), zero },
+									  TwoProdAVX2(_mm256_add_pd(_mm256_set1_pd((double)xIndex), laneIndex),
+												  _mm256_set1_pd(xMapStep)));
+
+			MDD256  curX     = pointX;
+			MDD256  curY     = pointY;
+
+			__m256i iterNum  = _mm256_setzero_si256();
+
+			__m256d interior = _mm256_setzero_pd();
+
+			if (params->interiorCheck)
+			{
+				interior = IsInteriorDDAVX2(pointX, pointY);
+				iterNum  = _mm256_and_si256(_mm256_castpd_si256(interior), maxIters);
+			}
+
+			MDD256  savedX     = curX;
+			MDD256  savedY     = curY;
+			size_t  checkpoint = 8;
+
+			__m256d escapeR2   = _mm256_setzero_pd();
+			__m256d active     = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+			KERNEL_STATS_VECTOR_BEGIN(stats);
+
+			for (size_t st = 0; st < maxIterations; st++)
+			{
+				MDD256 x2 = DDMulAVX2(curX, curX);
+				MDD256 y2 = DDMulAVX2(curY, curY);
+				MDD256 xy = DDMulAVX2(curX, curY);
+
+				MDD256 nextX = DDAddAVX2(DDAddAVX2(x2, DDNegAVX2(y2)), pointX);
+				MDD256 nextY = DDAddAVX2(DDScaleAVX2(xy, 2), pointY);
+
+				__m256d r2 = _mm256_fmadd_pd(nextX.hi, nextX.hi, _mm256_mul_pd(nextY.hi, nextY.hi));
+
+				__m256d cmpRes = _mm256_andnot_pd(interior, _mm256_cmp_pd(r2, maxR2, _CMP_LE_OQ));
+
+				KERNEL_STATS_TRIP(stats, 4, KernelStatsCountBits(_mm256_movemask_pd(cmpRes)));
+
+				if (smooth)
+					escapeR2 = _mm256_blendv_pd(escapeR2, r2, active);
+
+				if (_mm256_movemask_pd(cmpRes) == 0)
+					break; //     
+
+				active = cmpRes;
+
+				iterNum = _mm256_sub_epi64(iterNum, _mm256_castpd_si256(cmpRes));
+
+				curX = nextX;
+				curY = nextY;
+
+				if (params->periodCheck && (st & 7) == 0)
+				{
+					MDD256 diffX = DDAddAVX2(curX, DDNegAVX2(savedX));
+					MDD256 diffY = DDAddAVX2(curY, DDNegAVX2(savedY));
+
+					__m256d cycle =
+						_mm256_and_pd(cmpRes,
+							_mm256_and_pd(
+								_mm256_cmp_pd(_mm256_andnot_pd(signMask, diffX.hi), periodEps, _CMP_LT_OQ),
+								_mm256_cmp_pd(_mm256_andnot_pd(signMask, diffY.hi), periodEps, _CMP_LT_OQ)));
+
+					interior = _mm256_or_pd(interior, cycle);
+					iterNum  = _mm256_blendv_epi8(iterNum, maxIters, _mm256_castpd_si256(cycle));
+
+					if (st == checkpoint)
+					{
+						savedX      = curX;
+						savedY      = curY;
+						checkpoint *= 2;
+					}
+				}
+			}
+
+			KERNEL_STATS_VECTOR_END(stats);
+
+			_mm_storeu_si128((__m128i*)(row + xIndex - tile->x0),
+							 _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(iterNum, packLow)));
+
+			if (smooth)
+			{
+				alignas(16) float escapeR2f[4] = {};
+				_mm_store_ps(escapeR2f, _mm256_cvtpd_ps(escapeR2));
+
+				GetSmoothFractions(escapeR2f, 4, smoothScale, fractions + xIndex - tile->x0);
+			}
+		}
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\
\ No newline at end of file
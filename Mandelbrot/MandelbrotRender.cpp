@@ -0,0 +1,1593 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <emmintrin.h>
+
+#include "MandelbrotRender.h"
+
+#include "CpuFeatures.h"
+#include "FractalKernel.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+struct MPoint
+{
+	double x;
+	double y;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static double GetWidth(const MRect* rect);
+
+static double GetHeight(const MRect* rect);
+
+static void GetNextPoint(const MPoint* first, const MPoint* cur, MPoint* next);
+
+static size_t CalcPoint(const MPoint* point, const double maxR, const size_t iterations,
+						const bool periodCheck, double* escapeR2);
+
+static bool IsInteriorPoint(const MPoint* point);
+
+static __m128d IsInteriorSSE(const __m128d pointX, const __m128d pointY);
+
+static __m128i GetChannelSSE(const __m128d iterNums, const double base, const double step);
+
+static __m128i GetColorsSSE(const __m128d iterNums);
+
+static __m128i GetFourColorsSSE(const __m128i iterNums, const __m128i fractions);
+
+static __m128 FastLog2SSE(const __m128 x);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static double GetWidth(const MRect* rect)
+{
+	assert(rect);
+
+	return rect->maxX - rect->minX;
+}
+
+static double GetHeight(const MRect* rect)
+{
+	assert(rect);
+
+	return rect->maxY - rect->minY;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static inline void GetNextPoint(const MPoint* first, const MPoint* cur, MPoint* next)
+{
+	assert(first);
+	assert(cur);
+	assert(next);
+
+	MMandelbrotFormula::Step<MScalarOps>(cur->x, cur->y, first->x, first->y, &next->x, &next->y);
+}
+
+/**
+ * @brief        .
+ *
+ * @param maxR       ,       .
+ * @param iterations   ;    ,   .
+ * @param periodCheck     :   
+ *                     ,     1, 2, 4, 8, ...
+ *                         ,  
+ *                         .
+ * @param escapeR2         -   
+ *                    maxR^2 (   ).
+*/
+static inline size_t CalcPoint(const MPoint* point, const double maxR, const size_t iterations,
+							   const bool periodCheck, double* escapeR2)
+{
+	assert(point);
+	assert(escapeR2);
+
+	MPoint cur =
+	{
+		point->x,
+		point->y
+	};
+
+	MPoint next = {0, 0};
+
+	MPoint saved      = cur;
+	size_t checkpoint = 1;
+
+	for (size_t st = 0; st < iterations; st++)
+	{
+		GetNextPoint(point, &cur, &next);
+
+		*escapeR2 = next.x * next.x + next.y * next.y;
+
+		if (*escapeR2 > maxR * maxR)
+			return st;
+
+		cur.x = next.x;
+		cur.y = next.y;
+
+		if (periodCheck)
+		{
+			if (fabs(cur.x - saved.x) < 1e-12 && fabs(cur.y - saved.y) < 1e-12)
+				return iterations;
+
+			if (st == checkpoint)
+			{
+				saved       = cur;
+				checkpoint *= 2;
+			}
+		}
+	}
+
+	return iterations;
+}
+
+/**
+ * @brief ,          2.
+ *              ,     .
+ *
+ *        : q * (q + (x - 1/4)) <= y^2 / 4,  q = (x - 1/4)^2 + y^2.
+ *        :      (x + 1)^2 + y^2 <= 1/16.
+*/
+static inline bool IsInteriorPoint(const MPoint* point)
+{
+	assert(point);
+
+	bool interior = false;
+	MMandelbrotFormula::IsInterior<MScalarOps>(point->x, point->y, &interior);
+
+	return interior;
+}
+
+/**
+ * @brief  ,   IsInteriorPoint,    .
+ *
+ * @return :    ,   .
+*/
+static inline __m128d IsInteriorSSE(const __m128d pointX, const __m128d pointY)
+{
+	__m128d interior;
+	MMandelbrotFormula::IsInterior<MSSE2Ops>(pointX, pointY, &interior);
+
+	return interior;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+void RenderSimpleMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(map);
+	assert(params);
+	assert(tile);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double xMapStep = GetWidth(map)  / imageWidth;
+	double yMapStep = GetHeight(map) / imageHeight;
+
+	MPoint point = { map->minX, map->maxY };
+
+	const float smoothScale = GetSmoothScale(params);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		const size_t offset = (yIndex - tile->y0) * iterTile->stride;
+
+		uint32_t* row = iterTile->iterNums + offset;
+
+		point.y = map->maxY - yIndex * yMapStep;
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex++)
+		{
+			point.x = map->minX + xIndex * xMapStep;
+
+			size_t iterNum  = params->maxIterations;
+			double escapeR2 = 0;
+
+			if (!params->interiorCheck || !IsInteriorPoint(&point))
+				iterNum = CalcPoint(&point, params->bailout, params->maxIterations, params->periodCheck, &escapeR2);
+
+			row[xIndex - tile->x0] = (uint32_t)iterNum;
+
+			if (iterTile->fractions)
+			{
+				const float escapeR2f = (float)escapeR2;
+
+				GetSmoothFractions(&escapeR2f, 1, smoothScale, iterTile->fractions + offset + xIndex - tile->x0);
+			}
+		}
+	}
+}
+
+/**
+ * @brief   double   (SSE2):     .
+*/
+void RenderSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+						 const MIterTile* iterTile)
+{
+	RenderFormulaTile<MMandelbrotFormula, MSSE2Ops>(frame, map, params, tile, iterTile);
+}
+
+/**
+ * @brief  :   ,    RenderSSEMandelbrot,    z
+ *          dz/dc (dz' = 2 z dz + 1).    
+ *            |z| ln|z| / |dz|,     
+ *          (GetDistanceEstimates).       .
+*/
+void RenderDistanceSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								 const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(iterTile->distances);
+	assert(map);
+	assert(params);
+	assert(tile);
+	assert(tile->width % 2 == 0);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double minX     = map->minX;
+	double maxX     = map->maxX;
+
+	double minY     = map->minY;
+	double maxY     = map->maxY;
+
+	double xMapStep = (maxX - minX) / imageWidth;
+	double yMapStep = (maxY - minY) / imageHeight;
+
+	const __m128d laneIndex = _mm_set_pd(1, 0);
+
+	__m128d pointX = _mm_setzero_pd();
+	__m128d pointY = _mm_setzero_pd();
+	__m128d maxR2  = _mm_set1_pd(params->bailout * params->bailout);
+
+	const size_t  maxIterations = params->maxIterations;
+	const __m128i maxIters      = _mm_set1_epi64x((long long)maxIterations);
+
+	const __m128d signMask  = _mm_set1_pd(-0.0);
+	const __m128d periodEps = _mm_set1_pd(1e-12);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		uint32_t* row       = iterTile->iterNums  + (yIndex - tile->y0) * iterTile->stride;
+		float*    distances = iterTile->distances + (yIndex - tile->y0) * iterTile->stride;
+
+		pointY = _mm_set1_pd(maxY - yIndex * yMapStep);
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex += 2)
+		{
+			pointX = _mm_add_pd(_mm_set1_pd(minX),
+								_mm_mul_pd(_mm_add_pd(_mm_set1_pd((double)xIndex), laneIndex),
+										   _mm_set1_pd(xMapStep)));
+
+			__m128d curX     = pointX;
+			__m128d curY     = pointY;
+
+			// z1 = c,  dz1/dc = 1.
+			__m128d derX     = _mm_set1_pd(1);
+			__m128d derY     = _mm_setzero_pd();
+
+			__m128i iterNum  = _mm_set_epi64x(0, 0);
+
+			__m128d interior = _mm_setzero_pd();
+
+			if (params->interiorCheck)
+			{
+				interior = IsInteriorSSE(pointX, pointY);
+				iterNum  = _mm_and_si128(_mm_castpd_si128(interior), maxIters);
+			}
+
+			__m128d savedX     = curX;
+			__m128d savedY     = curY;
+			size_t  checkpoint = 8;
+
+			// |z|^2  |dz|^2  ,   .
+			__m128d escapeR2   = _mm_setzero_pd();
+			__m128d escapeDR2  = _mm_setzero_pd();
+			__m128d active     = _mm_castsi128_pd(_mm_set1_epi64x(-1));
+
+			KERNEL_STATS_VECTOR_BEGIN(stats);
+
+			for (size_t st = 0; st < maxIterations; st++)
+			{
+				__m128d nextX =
+					_mm_add_pd(
+						_mm_sub_pd(
+							_mm_mul_pd(curX, curX),
+							_mm_mul_pd(curY, curY)),
+						pointX);
+
+				__m128d nextY =
+					_mm_add_pd(
+						_mm_mul_pd(
+							_mm_set_pd(2, 2),
+							_mm_mul_pd(curX, curY)),
+						pointY);
+
+				// 2 (x dX - y dY) + 1
+				__m128d nextDerX =
+					_mm_add_pd(
+						_mm_mul_pd(
+							_mm_set1_pd(2),
+							_mm_sub_pd(_mm_mul_pd(curX, derX), _mm_mul_pd(curY, derY))),
+						_mm_set1_pd(1));
+
+				// 2 (x dY + y dX)
+				__m128d nextDerY =
+					_mm_mul_pd(
+						_mm_set1_pd(2),
+						_mm_add_pd(_mm_mul_pd(curX, derY), _mm_mul_pd(curY, derX)));
+
+				__m128d r2 =
+					_mm_add_pd(
+						_mm_mul_pd(nextX, nextX),
+						_mm_mul_pd(nextY, nextY));
+
+				__m128d dr2 =
+					_mm_add_pd(
+						_mm_mul_pd(nextDerX, nextDerX),
+						_mm_mul_pd(nextDerY, nextDerY));
+
+				__m128d cmpRes = _mm_andnot_pd(interior, _mm_cmple_pd(r2, maxR2));
+
+				KERNEL_STATS_TRIP(stats, 2, KernelStatsCountBits(_mm_movemask_pd(cmpRes)));
+
+				escapeR2  = _mm_or_pd(_mm_and_pd(active, r2),  _mm_andnot_pd(active, escapeR2));
+				escapeDR2 = _mm_or_pd(_mm_and_pd(active, dr2), _mm_andnot_pd(active, escapeDR2));
+
+				if (_mm_movemask_pd(cmpRes) == 0)
+					break; //     
+
+				active = cmpRes;
+
+				iterNum = _mm_sub_epi64(iterNum, _mm_castpd_si128(cmpRes));
+
+				curX = nextX;
+				curY = nextY;
+				derX = nextDerX;
+				derY = nextDerY;
+
+				//     RenderSSEMandelbrot.
+				if (params->periodCheck && (st & 7) == 0)
+				{
+					__m128d cycle =
+						_mm_and_pd(cmpRes,
+							_mm_and_pd(
+								_mm_cmplt_pd(_mm_andnot_pd(signMask, _mm_sub_pd(curX, savedX)), periodEps),
+								_mm_cmplt_pd(_mm_andnot_pd(signMask, _mm_sub_pd(curY, savedY)), periodEps)));
+
+					interior = _mm_or_pd(interior, cycle);
+					iterNum  = _mm_or_si128(_mm_andnot_si128(_mm_castpd_si128(cycle), iterNum),
+											_mm_and_si128(_mm_castpd_si128(cycle), maxIters));
+
+					if (st == checkpoint)
+					{
+						savedX      = curX;
+						savedY      = curY;
+						checkpoint *= 2;
+					}
+				}
+			}
+
+			KERNEL_STATS_VECTOR_END(stats);
+
+			_mm_storel_epi64((__m128i*)(row + xIndex - tile->x0), _mm_shuffle_epi32(iterNum, _MM_SHUFFLE(3, 1, 2, 0)));
+
+			//     :    
+			// ,      .
+			__m128d ratio = _mm_and_pd(_mm_cmpgt_pd(escapeR2, maxR2), _mm_div_pd(escapeR2, escapeDR2));
+
+			alignas(16) float escapeR2f[4] = {};
+			alignas(16) float ratiof[4]    = {};
+			_mm_store_ps(escapeR2f, _mm_cvtpd_ps(escapeR2));
+			_mm_store_ps(ratiof,    _mm_cvtpd_ps(ratio));
+
+			GetDistanceEstimates(escapeR2f, ratiof, 2, xMapStep, distances + xIndex - tile->x0);
+		}
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+/**
+ * @brief         2   -   ,
+ *           RenderSSEMandelbrot,     ,     .
+ *           ,     .
+*/
+void CalcPointsSSE(const double* pointsX, const double* pointsY, const size_t count,
+				   const MRenderParams* params, uint32_t* iterNums)
+{
+	assert(pointsX);
+	assert(pointsY);
+	assert(params);
+	assert(iterNums);
+
+	__m128d maxR2 = _mm_set1_pd(params->bailout * params->bailout);
+
+	const size_t  maxIterations = params->maxIterations;
+	const __m128i maxIters      = _mm_set1_epi64x((long long)maxIterations);
+
+	const __m128d signMask  = _mm_set1_pd(-0.0);
+	const __m128d periodEps = _mm_set1_pd(1e-12);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t index = 0; index < count; index += 2)
+	{
+		const size_t next = index + 1 < count ? index + 1 : index;
+
+		__m128d pointX   = _mm_set_pd(pointsX[next], pointsX[index]);
+		__m128d pointY   = _mm_set_pd(pointsY[next], pointsY[index]);
+
+		__m128d curX     = pointX;
+		__m128d curY     = pointY;
+
+		__m128i iterNum  = _mm_setzero_si128();
+
+		__m128d interior = _mm_setzero_pd();
+
+		if (params->interiorCheck)
+		{
+			interior = IsInteriorSSE(pointX, pointY);
+			iterNum  = _mm_and_si128(_mm_castpd_si128(interior), maxIters);
+		}
+
+		__m128d savedX     = curX;
+		__m128d savedY     = curY;
+		size_t  checkpoint = 8;
+
+		KERNEL_STATS_VECTOR_BEGIN(stats);
+
+		for (size_t st = 0; st < maxIterations; st++)
+		{
+			__m128d nextX = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(curX, curX), _mm_mul_pd(curY, curY)), pointX);
+			__m128d nextY = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(2), _mm_mul_pd(curX, curY)), pointY);
+
+			__m128d r2 = _mm_add_pd(_mm_mul_pd(nextX, nextX), _mm_mul_pd(nextY, nextY));
+
+			__m128d cmpRes = _mm_andnot_pd(interior, _mm_cmple_pd(r2, maxR2));
+
+			KERNEL_STATS_TRIP(stats, 2, KernelStatsCountBits(_mm_movemask_pd(cmpRes)));
+
+			if (_mm_movemask_pd(cmpRes) == 0)
+				break; //     
+
+			iterNum = _mm_sub_epi64(iterNum, _mm_castpd_si128(cmpRes));
+
+			curX = nextX;
+			curY = nextY;
+
+			if (params->periodCheck && (st & 7) == 0)
+			{
+				__m128d cycle =
+					_mm_and_pd(cmpRes,
+						_mm_and_pd(
+							_mm_cmplt_pd(_mm_andnot_pd(signMask, _mm_sub_pd(curX, savedX)), periodEps),
+							_mm_cmplt_pd(_mm_andnot_pd(signMask, _mm_sub_pd(curY, savedY)), periodEps)));
+
+				interior = _mm_or_pd(interior, cycle);
+				iterNum  = _mm_or_si128(_mm_andnot_si128(_mm_castpd_si128(cycle), iterNum),
+										_mm_and_si128(_mm_castpd_si128(cycle), maxIters));
+
+				if (st == checkpoint)
+				{
+					savedX      = curX;
+					savedY      = curY;
+					checkpoint *= 2;
+				}
+			}
+		}
+
+		KERNEL_STATS_VECTOR_END(stats);
+
+		alignas(16) long long ptr_iterNum[2] = {};
+		_mm_store_si128((__m128i*)ptr_iterNum, iterNum);
+
+		iterNums[index] = (uint32_t)ptr_iterNum[0];
+		iterNums[next]  = (uint32_t)ptr_iterNum[1];
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+/**
+ * @brief   float   (SSE):     .
+ *         float     .
+*/
+void RenderFloatSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							  const MIterTile* iterTile)
+{
+	RenderFormulaTile<MMandelbrotFormula, MFloatSSEOps>(frame, map, params, tile, iterTile);
+}
+
+/**
+ * @brief  RenderFloatSSEMandelbrot,        .
+ *                     ,
+ *          ,        .
+ *            ,  4    .
+*/
+void RenderFloatSSERefillMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params,
+									const MTile* tile, const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(map);
+	assert(params);
+	assert(tile);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double minX     = map->minX;
+	double maxX     = map->maxX;
+
+	double minY     = map->minY;
+	double maxY     = map->maxY;
+
+	double xMapStep = (maxX - minX) / imageWidth;
+	double yMapStep = (maxY - minY) / imageHeight;
+
+	//    ,   RenderFloatSSEMandelbrot,   .
+	const float minXf     = (float)minX;
+	const float xMapStepf = (float)xMapStep;
+
+	const size_t pixelCount = tile->width * tile->height;
+	size_t       nextPixel  = 0;
+
+	//-----------------------------------------------------------------------
+	//      ,      
+	//    :     -  store forwarding.
+	//-----------------------------------------------------------------------
+
+	const __m128i laneMasks[4] =
+	{
+		_mm_set_epi32( 0,  0,  0, -1),
+		_mm_set_epi32( 0,  0, -1,  0),
+		_mm_set_epi32( 0, -1,  0,  0),
+		_mm_set_epi32(-1,  0,  0,  0)
+	};
+
+	uint32_t* laneIter[4] = {};
+
+	int activeMask = 0;
+	int doneMask   = 0xF;
+
+	const __m128i maxIters = _mm_set1_epi32((int)params->maxIterations);
+	const __m128i zero     = _mm_setzero_si128();
+
+	__m128  pointX  = _mm_setzero_ps();
+	__m128  pointY  = _mm_setzero_ps();
+	__m128  curX    = _mm_setzero_ps();
+	__m128  curY    = _mm_setzero_ps();
+	__m128i iterNum = _mm_setzero_si128();
+	__m128  maxR2   = _mm_set_ps1((float)(params->bailout * params->bailout));
+
+	//-----------------------------------------------------------------------
+	//       ,    
+	//           .
+	//-----------------------------------------------------------------------
+
+	const __m128 signMask  = _mm_set_ps1(-0.0f);
+	const __m128 periodEps = _mm_set_ps1(1e-6f);
+
+	__m128  savedX     = _mm_setzero_ps();
+	__m128  savedY     = _mm_setzero_ps();
+	__m128i checkpoint = _mm_setzero_si128();
+	size_t  step       = 0;
+
+	//     ,   , 
+	//  r2   |z|^2   .
+	const bool  smooth      = iterTile->fractions != nullptr;
+	const float smoothScale = GetSmoothScale(params);
+
+	__m128 lastR2 = _mm_setzero_ps();
+
+	KERNEL_STATS_BEGIN(stats);
+
+	while (true)
+	{
+		if (doneMask)
+		{
+			alignas(16) int ptr_iterNum[4] = {};
+			_mm_store_si128((__m128i*)ptr_iterNum, iterNum);
+
+			alignas(16) float    lastR2f[4]   = {};
+			alignas(16) uint16_t fractions[4] = {};
+
+			if (smooth)
+			{
+				_mm_store_ps(lastR2f, lastR2);
+				GetSmoothFractions(lastR2f, 4, smoothScale, fractions);
+			}
+
+			for (size_t lane = 0; lane < 4; lane++)
+			{
+				if (!(doneMask & (1 << lane)))
+					continue;
+
+				if (activeMask & (1 << lane))
+				{
+					*laneIter[lane] = (uint32_t)ptr_iterNum[lane];
+
+					if (smooth)
+						iterTile->fractions[laneIter[lane] - iterTile->iterNums] = fractions[lane];
+				}
+
+				size_t xIndex = 0;
+				size_t yIndex = 0;
+
+				float  newXf  = 0;
+				float  newYf  = 0;
+
+				//        .
+				for (; nextPixel < pixelCount; nextPixel++)
+				{
+					xIndex = tile->x0 + nextPixel % tile->width;
+					yIndex = tile->y0 + nextPixel / tile->width;
+
+					newXf  = minXf + (float)xIndex * xMapStepf;
+					newYf  = (float)(maxY - yIndex * yMapStep);
+
+					const MPoint point = { newXf, newYf };
+
+					if (!params->interiorCheck || !IsInteriorPoint(&point))
+						break;
+
+					const size_t offset = (yIndex - tile->y0) * iterTile->stride + xIndex - tile->x0;
+
+					iterTile->iterNums[offset] = (uint32_t)params->maxIterations;
+
+					if (smooth)
+						iterTile->fractions[offset] = 0;
+				}
+
+				if (nextPixel == pixelCount)
+				{
+					activeMask &= ~(1 << lane);
+					continue;
+				}
+
+				__m128 newX = _mm_set_ps1(newXf);
+				__m128 newY = _mm_set_ps1(newYf);
+				__m128 mask = _mm_castsi128_ps(laneMasks[lane]);
+
+				pointX  = _mm_or_ps(_mm_and_ps(mask, newX), _mm_andnot_ps(mask, pointX));
+				pointY  = _mm_or_ps(_mm_and_ps(mask, newY), _mm_andnot_ps(mask, pointY));
+				curX    = _mm_or_ps(_mm_and_ps(mask, newX), _mm_andnot_ps(mask, curX));
+				curY    = _mm_or_ps(_mm_and_ps(mask, newY), _mm_andnot_ps(mask, curY));
+				iterNum = _mm_andnot_si128(laneMasks[lane], iterNum);
+
+				savedX     = _mm_or_ps(_mm_and_ps(mask, newX), _mm_andnot_ps(mask, savedX));
+				savedY     = _mm_or_ps(_mm_and_ps(mask, newY), _mm_andnot_ps(mask, savedY));
+				checkpoint = _mm_or_si128(_mm_and_si128(laneMasks[lane], _mm_set1_epi32(8)),
+										  _mm_andnot_si128(laneMasks[lane], checkpoint));
+
+				laneIter[lane] = iterTile->iterNums + (yIndex - tile->y0) * iterTile->stride + xIndex - tile->x0;
+
+				activeMask |= 1 << lane;
+				nextPixel++;
+			}
+
+			if (activeMask == 0)
+				break;
+		}
+
+		__m128 nextX =
+			_mm_add_ps(
+				_mm_sub_ps(
+					_mm_mul_ps(curX, curX),
+					_mm_mul_ps(curY, curY)),
+				pointX);
+
+		__m128 nextY =
+			_mm_add_ps(
+				_mm_mul_ps(
+					_mm_set_ps1(2),
+					_mm_mul_ps(curX, curY)),
+				pointY);
+
+		__m128 r2 =
+			_mm_add_ps(
+				_mm_mul_ps(nextX, nextX),
+				_mm_mul_ps(nextY, nextY));
+
+		__m128 cmpRes = _mm_cmple_ps(r2, maxR2);
+
+		KERNEL_STATS_TRIP(stats, 4, KernelStatsCountBits(_mm_movemask_ps(cmpRes) & activeMask));
+
+		lastR2 = r2;
+
+		iterNum = _mm_sub_epi32(iterNum, _mm_castps_si128(cmpRes));
+
+		curX = nextX;
+		curY = nextY;
+
+		if (params->periodCheck && (++step & 7) == 0)
+		{
+			__m128 cycle =
+				_mm_and_ps(cmpRes,
+					_mm_and_ps(
+						_mm_cmplt_ps(_mm_andnot_ps(signMask, _mm_sub_ps(curX, savedX)), periodEps),
+						_mm_cmplt_ps(_mm_andnot_ps(signMask, _mm_sub_ps(curY, savedY)), periodEps)));
+
+			iterNum = _mm_or_si128(_mm_andnot_si128(_mm_castps_si128(cycle), iterNum),
+								   _mm_and_si128(_mm_castps_si128(cycle), maxIters));
+
+			__m128i save = _mm_cmpgt_epi32(iterNum, checkpoint);
+			__m128  mask = _mm_castsi128_ps(save);
+
+			savedX     = _mm_or_ps(_mm_and_ps(mask, curX), _mm_andnot_ps(mask, savedX));
+			savedY     = _mm_or_ps(_mm_and_ps(mask, curY), _mm_andnot_ps(mask, savedY));
+			checkpoint = _mm_or_si128(_mm_and_si128(save, _mm_slli_epi32(checkpoint, 1)),
+									  _mm_andnot_si128(save, checkpoint));
+		}
+
+		//  :       .
+		__m128i done = _mm_or_si128(_mm_cmpeq_epi32(_mm_castps_si128(cmpRes), zero),
+									_mm_cmpeq_epi32(iterNum, maxIters));
+
+		doneMask = _mm_movemask_ps(_mm_castsi128_ps(done)) & activeMask;
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+bool IsKernelSupported(const MKernel kernel)
+{
+	const MCpuFeatures* features = GetCpuFeatures();
+
+	switch (kernel)
+	{
+		case MKERNEL_SIMPLE:
+		case MKERNEL_SSE:
+		case MKERNEL_FLOAT_SSE:
+		case MKERNEL_FLOAT_SSE_REFILL:
+		case MKERNEL_DD_SSE:
+		case MKERNEL_DE_SSE:
+		case MKERNEL_DOUBLE:
+			return true;
+
+		case MKERNEL_AVX2:
+		case MKERNEL_DD_AVX2:
+		case MKERNEL_DE_AVX2:
+			return features->avx2 && features->fma;
+
+		case MKERNEL_AVX512:
+			return features->avx512f;
+
+		default:
+			return false;
+	}
+}
+
+size_t GetKernelWidth(const MKernel kernel)
+{
+	switch (kernel)
+	{
+		case MKERNEL_SIMPLE:           return 1;
+		case MKERNEL_SSE:              return 2;
+		case MKERNEL_FLOAT_SSE:        return 4;
+		case MKERNEL_FLOAT_SSE_REFILL: return 1;
+		case MKERNEL_AVX2:             return 4;
+		case MKERNEL_AVX512:           return 8;
+		case MKERNEL_DD_SSE:           return 2;
+		case MKERNEL_DD_AVX2:          return 4;
+		case MKERNEL_DE_SSE:           return 2;
+		case MKERNEL_DE_AVX2:          return 4;
+		default:                       return 1;
+	}
+}
+
+const char* GetKernelName(const MKernel kernel)
+{
+	switch (kernel)
+	{
+		case MKERNEL_SIMPLE:           return "simple";
+		case MKERNEL_SSE:              return "sse";
+		case MKERNEL_FLOAT_SSE:        return "float";
+		case MKERNEL_FLOAT_SSE_REFILL: return "float-refill";
+		case MKERNEL_AVX2:             return "avx2";
+		case MKERNEL_AVX512:           return "avx512";
+		case MKERNEL_DD_SSE:           return "dd-sse";
+		case MKERNEL_DD_AVX2:          return "dd-avx2";
+		case MKERNEL_DE_SSE:           return "de-sse";
+		case MKERNEL_DE_AVX2:          return "de-avx2";
+		case MKERNEL_DOUBLE:           return "double";
+		default:                       return "unknown";
+	}
+}
+
+const char* GetFractalName(const MFractal fractal)
+{
+	switch (fractal)
+	{
+		case MFRACTAL_MANDELBROT:    return "mandelbrot";
+		case MFRACTAL_JULIA:         return "julia";
+		case MFRACTAL_BURNING_SHIP:  return "burning-ship";
+		case MFRACTAL_MULTIBROT:     return "multibrot";
+		default:                     return "unknown";
+	}
+}
+
+/**
+ * @brief ,         DOUBLE_MIN_RELATIVE_STEP
+ *         max(1, |c|):      2,    
+ *          double   ~1e-16.
+*/
+bool IsDoublePrecisionEnough(const MFrame* frame, const MRect* map)
+{
+	assert(frame);
+	assert(map);
+
+	const double xScale = fmax(1, fmax(fabs(map->minX), fabs(map->maxX)));
+	const double yScale = fmax(1, fmax(fabs(map->minY), fabs(map->maxY)));
+
+	return GetWidth(map)  / frame->width  >= DOUBLE_MIN_RELATIVE_STEP * xScale &&
+		   GetHeight(map) / frame->height >= DOUBLE_MIN_RELATIVE_STEP * yScale;
+}
+
+/**
+ * @brief    double ,   
+ *        (     , . RenderMandelbrotTile).   
+ *             double,  double-double .
+ *            CPUID     .
+*/
+MKernel GetDoubleKernel(const MFrame* frame, const MRect* map)
+{
+	assert(frame);
+	assert(map);
+
+	static const bool avx512 = IsKernelSupported(MKERNEL_AVX512);
+	static const bool avx2   = IsKernelSupported(MKERNEL_AVX2);
+
+	if (!IsDoublePrecisionEnough(frame, map))
+		return avx2 ? MKERNEL_DD_AVX2 : MKERNEL_DD_SSE;
+
+	if (avx512)
+		return MKERNEL_AVX512;
+
+	if (avx2)
+		return MKERNEL_AVX2;
+
+	return MKERNEL_SSE;
+}
+
+bool IsDistanceKernel(const MKernel kernel)
+{
+	return kernel == MKERNEL_DE_SSE || kernel == MKERNEL_DE_AVX2;
+}
+
+/**
+ * @brief       ,  GetDoubleKernel: AVX2,
+ *          ,  SSE.
+*/
+MKernel GetDistanceKernel(const MFrame* frame)
+{
+	assert(frame);
+
+	static const bool avx2 = IsKernelSupported(MKERNEL_DE_AVX2);
+
+	return avx2 ? MKERNEL_DE_AVX2 : MKERNEL_DE_SSE;
+}
+
+/**
+ * @brief     .    255    256,
+ *              .
+*/
+RGBQUAD GetIterColor(const size_t iterNum)
+{
+	RGBQUAD color = {};
+
+	color.rgbBlue  = (BYTE)(long long)(48  + 11.6341 * (double)iterNum);
+	color.rgbGreen = (BYTE)(long long)(134 + 13.1257 * (double)iterNum);
+	color.rgbRed   = (BYTE)(long long)(243 + 15.2312 * (double)iterNum);
+
+	return color;
+}
+
+/**
+ * @brief     -   floor(base + step * n),   GetIterColor.
+ *        floor     :   2^52    ,
+ *           .  r + 2^52    -  r, 
+ *           GetIterColor   n  MAX_ITERATIONS.
+*/
+static inline __m128i GetChannelSSE(const __m128d iterNums, const double base, const double step)
+{
+	const __m128d magic = _mm_set1_pd(4503599627370496.0); // 2^52
+
+	__m128d value   = _mm_add_pd(_mm_set1_pd(base), _mm_mul_pd(_mm_set1_pd(step), iterNums));
+	__m128d rounded = _mm_sub_pd(_mm_add_pd(value, magic), magic);
+
+	rounded = _mm_sub_pd(rounded, _mm_and_pd(_mm_cmpgt_pd(rounded, value), _mm_set1_pd(1)));
+
+	return _mm_and_si128(_mm_castpd_si128(_mm_add_pd(rounded, magic)), _mm_set1_epi64x(0xFF));
+}
+
+/**
+ * @brief      32  64- .
+*/
+static inline __m128i GetColorsSSE(const __m128d iterNums)
+{
+	const __m128i blue  = GetChannelSSE(iterNums, 48,  11.6341);
+	const __m128i green = GetChannelSSE(iterNums, 134, 13.1257);
+	const __m128i red   = GetChannelSSE(iterNums, 243, 15.2312);
+
+	return _mm_or_si128(blue, _mm_or_si128(_mm_slli_epi64(green, 8), _mm_slli_epi64(red, 16)));
+}
+
+/**
+ * @brief          ( 64  fractions):
+ *         n - fraction / 65536    ,    GetIterColor.
+*/
+static inline __m128i GetFourColorsSSE(const __m128i iterNums, const __m128i fractions)
+{
+	const __m128i fractions32 = _mm_unpacklo_epi16(fractions, _mm_setzero_si128());
+	const __m128d fractionStep = _mm_set1_pd(1.0 / 65536);
+
+	const __m128d low  = _mm_sub_pd(_mm_cvtepi32_pd(iterNums),
+									_mm_mul_pd(_mm_cvtepi32_pd(fractions32), fractionStep));
+	const __m128d high = _mm_sub_pd(_mm_cvtepi32_pd(_mm_srli_si128(iterNums, 8)),
+									_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(fractions32, 8)), fractionStep));
+
+	const __m128i lowColors  = GetColorsSSE(low);
+	const __m128i highColors = GetColorsSSE(high);
+
+	return _mm_unpacklo_epi64(_mm_shuffle_epi32(lowColors,  _MM_SHUFFLE(3, 1, 2, 0)),
+							  _mm_shuffle_epi32(highColors, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+/**
+ * @brief log2   float  math.h:     ,
+ *           [sqrt(1/2), sqrt(2)),     
+ *        2 / ln2 * (s + s^3 / 3 + s^5 / 5 + s^7 / 7), s = (m - 1) / (m + 1), |s| < 0.18.
+ *          1e-7 -    16-  .   - -127.
+*/
+static inline __m128 FastLog2SSE(const __m128 x)
+{
+	const __m128i bits     = _mm_castps_si128(x);
+	const __m128i exponent = _mm_srai_epi32(_mm_sub_epi32(bits, _mm_set1_epi32(0x3F3504F3)), 23); // sqrt(1/2)
+
+	const __m128 mantissa = _mm_castsi128_ps(_mm_sub_epi32(bits, _mm_slli_epi32(exponent, 23)));
+
+	const __m128 s  = _mm_div_ps(_mm_sub_ps(mantissa, _mm_set_ps1(1)), _mm_add_ps(mantissa, _mm_set_ps1(1)));
+	const __m128 s2 = _mm_mul_ps(s, s);
+
+	__m128 series = _mm_set_ps1(0.41219858f);                                       // 2 / (7 ln2)
+	series = _mm_add_ps(_mm_mul_ps(series, s2), _mm_set_ps1(0.57707802f));          // 2 / (5 ln2)
+	series = _mm_add_ps(_mm_mul_ps(series, s2), _mm_set_ps1(0.96179669f));          // 2 / (3 ln2)
+	series = _mm_add_ps(_mm_mul_ps(series, s2), _mm_set_ps1(2.88539008f));          // 2 / ln2
+
+	return _mm_add_ps(_mm_cvtepi32_ps(exponent), _mm_mul_ps(series, s));
+}
+
+/**
+ * @brief  1 / log2(R^2)  GetSmoothFractions.
+*/
+float GetSmoothScale(const MRenderParams* params)
+{
+	assert(params);
+
+	return (float)(1 / log2(params->bailout * params->bailout));
+}
+
+/**
+ * @brief            .
+ *        ,   n   |z|^2 = r2,   n - log2(log(r2) / log(R^2)):
+ *         ,    ,    0,   ,  
+ *          ,    R^4, -  1,     
+ *          . ,     (r2 <= R^2),  0.
+ *            4  (FastLog2SSE),   log()  .
+ *
+ * @param smoothScale 1 / log2(R^2) (GetSmoothScale).
+ * @param fractions      1/65536.
+*/
+void GetSmoothFractions(const float* escapeR2, const size_t count, const float smoothScale, uint16_t* fractions)
+{
+	assert(escapeR2  || count == 0);
+	assert(fractions || count == 0);
+
+	for (size_t st = 0; st < count; st += 4)
+	{
+		const size_t lanes = count - st < 4 ? count - st : 4;
+
+		__m128 r2 = _mm_setzero_ps();
+
+		if (lanes == 4)
+			r2 = _mm_loadu_ps(escapeR2 + st);
+		else
+		{
+			alignas(16) float tail[4] = {};
+
+			for (size_t lane = 0; lane < lanes; lane++)
+				tail[lane] = escapeR2[st + lane];
+
+			r2 = _mm_load_ps(tail);
+		}
+
+		const __m128 ratio    = _mm_max_ps(_mm_mul_ps(FastLog2SSE(r2), _mm_set_ps1(smoothScale)), _mm_set_ps1(1));
+		const __m128 fraction = _mm_min_ps(FastLog2SSE(ratio), _mm_set_ps1(65535.0f / 65536));
+
+		//  SSE2    32 -> 16 :      .
+		__m128i fixed = _mm_cvttps_epi32(_mm_mul_ps(_mm_max_ps(fraction, _mm_setzero_ps()), _mm_set_ps1(65536)));
+
+		fixed = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(fixed, _mm_set1_epi32(32768)), _mm_setzero_si128()),
+							  _mm_set1_epi16((short)0x8000));
+
+		if (lanes == 4)
+			_mm_storel_epi64((__m128i*)(fractions + st), fixed);
+		else
+		{
+			alignas(16) uint16_t tail[8] = {};
+			_mm_store_si128((__m128i*)tail, fixed);
+
+			for (size_t lane = 0; lane < lanes; lane++)
+				fractions[st + lane] = tail[lane];
+		}
+	}
+}
+
+/**
+ * @brief    : d = |z| ln|z| / |dz| = sqrt(r2 / dr2) * log2(r2) * ln2 / 2,
+ *           .    4  (FastLog2SSE).
+ *
+ * @param escapeR2  |z|^2   .
+ * @param ratios    |z|^2 / |dz|^2   ; 0   . NaN (
+ *                  )   0 -   .
+ * @param pixelSize     .
+*/
+void GetDistanceEstimates(const float* escapeR2, const float* ratios, const size_t count, const double pixelSize,
+						  float* distances)
+{
+	assert(escapeR2  || count == 0);
+	assert(ratios    || count == 0);
+	assert(distances || count == 0);
+	assert(pixelSize > 0);
+
+	const __m128 scale = _mm_set_ps1((float)(0.5 * 0.6931471805599453 / pixelSize));
+
+	for (size_t st = 0; st < count; st += 4)
+	{
+		const size_t lanes = count - st < 4 ? count - st : 4;
+
+		alignas(16) float r2[4]    = {};
+		alignas(16) float ratio[4] = {};
+
+		for (size_t lane = 0; lane < lanes; lane++)
+		{
+			r2[lane]    = escapeR2[st + lane];
+			ratio[lane] = ratios[st + lane];
+		}
+
+		// max(NaN, 0)  SSE   .
+		const __m128 root = _mm_sqrt_ps(_mm_max_ps(_mm_load_ps(ratio), _mm_setzero_ps()));
+
+		const __m128 distance =
+			_mm_max_ps(_mm_mul_ps(_mm_mul_ps(root, FastLog2SSE(_mm_load_ps(r2))), scale), _mm_setzero_ps());
+
+		if (lanes == 4)
+			_mm_storeu_ps(distances + st, distance);
+		else
+		{
+			alignas(16) float tail[4] = {};
+			_mm_store_ps(tail, distance);
+
+			for (size_t lane = 0; lane < lanes; lane++)
+				distances[st + lane] = tail[lane];
+		}
+	}
+}
+
+/**
+ * @brief     :  255 * min(d / DISTANCE_SHADE_PIXELS, 1)^(1/4),
+ *             ,    (d = 0) -  .
+*/
+void ColorizeDistances(const float* distances, RGBQUAD* pixels, const size_t count)
+{
+	assert(distances || count == 0);
+	assert(pixels    || count == 0);
+
+	const __m128 scale = _mm_set_ps1((float)(1 / DISTANCE_SHADE_PIXELS));
+
+	for (size_t st = 0; st < count; st += 4)
+	{
+		const size_t lanes = count - st < 4 ? count - st : 4;
+
+		__m128 distance = _mm_setzero_ps();
+
+		if (lanes == 4)
+			distance = _mm_loadu_ps(distances + st);
+		else
+		{
+			alignas(16) float tail[4] = {};
+
+			for (size_t lane = 0; lane < lanes; lane++)
+				tail[lane] = distances[st + lane];
+
+			distance = _mm_load_ps(tail);
+		}
+
+		const __m128 shade = _mm_min_ps(_mm_mul_ps(distance, scale), _mm_set_ps1(1));
+
+		const __m128i gray = _mm_cvtps_epi32(_mm_mul_ps(_mm_sqrt_ps(_mm_sqrt_ps(shade)), _mm_set_ps1(255)));
+
+		const __m128i colors = _mm_or_si128(_mm_or_si128(gray, _mm_slli_epi32(gray, 8)), _mm_slli_epi32(gray, 16));
+
+		if (lanes == 4)
+			_mm_storeu_si128((__m128i*)(pixels + st), colors);
+		else
+		{
+			alignas(16) RGBQUAD tail[4] = {};
+			_mm_store_si128((__m128i*)tail, colors);
+
+			for (size_t lane = 0; lane < lanes; lane++)
+				pixels[st + lane] = tail[lane];
+		}
+	}
+}
+
+/**
+ * @brief      -  ,  GetIterColor  ,
+ *          4   .       :
+ *           ,     .
+ *
+ * @param fractions      (GetSmoothFractions)  nullptr.
+*/
+void ColorizeIterations(const uint32_t* iterNums, const uint16_t* fractions, RGBQUAD* pixels, const size_t count)
+{
+	assert(iterNums || count == 0);
+	assert(pixels   || count == 0);
+
+	size_t st = 0;
+
+	for (; st + 4 <= count; st += 4)
+	{
+		const __m128i iters = _mm_loadu_si128((const __m128i*)(iterNums + st));
+		const __m128i fracs = fractions ? _mm_loadl_epi64((const __m128i*)(fractions + st)) : _mm_setzero_si128();
+
+		_mm_storeu_si128((__m128i*)(pixels + st), GetFourColorsSSE(iters, fracs));
+	}
+
+	if (st == count)
+		return;
+
+	alignas(16) uint32_t iters[4] = {};
+	alignas(16) uint16_t fracs[8] = {};
+	alignas(16) RGBQUAD  colors[4] = {};
+
+	for (size_t lane = 0; st + lane < count; lane++)
+	{
+		iters[lane] = iterNums[st + lane];
+		fracs[lane] = fractions ? fractions[st + lane] : 0;
+	}
+
+	_mm_store_si128((__m128i*)colors, GetFourColorsSSE(_mm_load_si128((const __m128i*)iters),
+													   _mm_load_si128((const __m128i*)fracs)));
+
+	for (size_t lane = 0; st + lane < count; lane++)
+		pixels[st + lane] = colors[lane];
+}
+
+/**
+ * @brief      .
+ *
+ * @return false,      .
+*/
+bool ColorizeFrame(const MFrame* frame)
+{
+	assert(frame);
+	assert(frame->pixels);
+
+	if (!frame->iterNums)
+		return false;
+
+	for (size_t y = 0; y < frame->height; y++)
+	{
+		const size_t start = y * frame->stride;
+
+		if (frame->distances)
+			ColorizeDistances(frame->distances + start, frame->pixels + start, frame->width);
+		else
+			ColorizeIterations(frame->iterNums + start, frame->fractions ? frame->fractions + start : nullptr,
+							   frame->pixels + start, frame->width);
+	}
+
+	return true;
+}
+
+/**
+ * @brief    :   ,   ,  
+ *           .       ;
+ *               ,      .
+ *               ,    .
+ *
+ * @param renderWidth    :  ,    .
+ *                               
+ *                    (stride - width).           ,
+ *                        .
+ *
+ * @return false,    .
+*/
+bool IterTileCreate(MIterTile* iterTile, const MFrame* frame, const MRenderParams* params, const MTile* tile,
+					const size_t renderWidth)
+{
+	assert(iterTile);
+	assert(frame);
+	assert(params);
+	assert(tile);
+	assert(renderWidth >= tile->width);
+
+	const bool distance = IsDistanceKernel(params->kernel);
+	const bool smooth   = params->smoothColoring && !distance;
+
+	const bool padded = renderWidth != tile->width;
+
+	if (frame->iterNums && (frame->fractions || !smooth) && (frame->distances || !distance) &&
+		(!padded || (tile->x0 + tile->width == frame->width && tile->x0 + renderWidth <= frame->stride)))
+	{
+		const size_t start = tile->y0 * frame->stride + tile->x0;
+
+		if (frame->fractions && !smooth)
+			for (size_t y = 0; y < tile->height; y++)
+				memset(frame->fractions + start + y * frame->stride, 0, tile->width * sizeof(uint16_t));
+
+		*iterTile = MIterTile { frame->iterNums + start, smooth ? frame->fractions + start : nullptr,
+								distance ? frame->distances + start : nullptr, frame->stride, false };
+		return true;
+	}
+
+	//             
+	//     .
+	const size_t pixelCount = renderWidth * tile->height > 0 ? renderWidth * tile->height : 1;
+
+	uint32_t* iterNums = (uint32_t*)malloc(pixelCount * (sizeof(uint32_t) + (distance ? sizeof(float)    : 0)
+																			+ (smooth   ? sizeof(uint16_t) : 0)));
+
+	*iterTile = MIterTile { iterNums, iterNums && smooth ? (uint16_t*)(iterNums + pixelCount) : nullptr,
+							iterNums && distance ? (float*)(iterNums + pixelCount) : nullptr, renderWidth, true };
+
+	return iterNums != nullptr;
+}
+
+/**
+ * @brief        (  ),
+ *             ,    ,   .
+*/
+void IterTileFinish(MIterTile* iterTile, const MFrame* frame, const MTile* tile)
+{
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(frame);
+	assert(frame->pixels);
+	assert(tile);
+
+	for (size_t y = 0; y < tile->height; y++)
+	{
+		const size_t start  = (tile->y0 + y) * frame->stride + tile->x0;
+		const size_t offset = y * iterTile->stride;
+
+		if (iterTile->distances)
+			ColorizeDistances(iterTile->distances + offset, frame->pixels + start, tile->width);
+		else
+			ColorizeIterations(iterTile->iterNums + offset, iterTile->fractions ? iterTile->fractions + offset : nullptr,
+							   frame->pixels + start, tile->width);
+
+		if (!iterTile->owned)
+			continue;
+
+		if (frame->iterNums)
+			memcpy(frame->iterNums + start, iterTile->iterNums + offset, tile->width * sizeof(uint32_t));
+
+		if (frame->fractions && iterTile->fractions)
+			memcpy(frame->fractions + start, iterTile->fractions + offset, tile->width * sizeof(uint16_t));
+		else if (frame->fractions)
+			memset(frame->fractions + start, 0, tile->width * sizeof(uint16_t));
+
+		if (frame->distances && iterTile->distances)
+			memcpy(frame->distances + start, iterTile->distances + offset, tile->width * sizeof(float));
+	}
+
+	if (iterTile->owned)
+		free(iterTile->iterNums);
+
+	*iterTile = MIterTile {};
+}
+
+/**
+ * @brief     width: ,   FRAME_ROW_ALIGNMENT .
+ *                 .
+*/
+size_t GetFrameStride(const size_t width)
+{
+	return (width + FRAME_ROW_ALIGNMENT - 1) / FRAME_ROW_ALIGNMENT * FRAME_ROW_ALIGNMENT;
+}
+
+/**
+ * @brief     ,   FRAME_ALIGNMENT: ,
+ *              ,         GetFrameStride.
+ *
+ * @return false,    MAX_FRAME_SIZE    .
+*/
+bool FrameCreate(MFrame* frame, const size_t width, const size_t height, const bool iterations,
+				 const bool fractions, const bool distances)
+{
+	assert(frame);
+
+	*frame = MFrame {};
+
+	if (width == 0 || height == 0 || width > MAX_FRAME_SIZE || height > MAX_FRAME_SIZE)
+		return false;
+
+	const size_t stride     = GetFrameStride(width);
+	const size_t pixelCount = stride * height;
+
+	const size_t pixelBytes = sizeof(RGBQUAD) + (iterations ? sizeof(uint32_t) : 0) +
+							  (distances ? sizeof(float) : 0) + (fractions ? sizeof(uint16_t) : 0);
+
+	//  16K x 16K    32-  .
+	if (pixelCount > SIZE_MAX / pixelBytes)
+		return false;
+
+	//     ,  FRAME_ALIGNMENT,    .
+	const size_t bytes = pixelCount * pixelBytes;
+
+#ifdef _WIN32
+	unsigned char* block = (unsigned char*)_aligned_malloc(bytes, FRAME_ALIGNMENT);
+#else
+	unsigned char* block = nullptr;
+
+	if (posix_memalign((void**)&block, FRAME_ALIGNMENT, bytes) != 0)
+		block = nullptr;
+#endif
+
+	if (!block)
+		return false;
+
+	memset(block, 0, bytes);
+
+	unsigned char* next = block + pixelCount * sizeof(RGBQUAD);
+
+	*frame = MFrame {};
+
+	frame->pixels = (RGBQUAD*)block;
+	frame->width  = width;
+	frame->height = height;
+	frame->stride = stride;
+
+	if (iterations)
+	{
+		frame->iterNums = (uint32_t*)next;
+		next += pixelCount * sizeof(uint32_t);
+	}
+
+	if (distances)
+	{
+		frame->distances = (float*)next;
+		next += pixelCount * sizeof(float);
+	}
+
+	if (fractions)
+		frame->fractions = (uint16_t*)next;
+
+	return true;
+}
+
+void FrameDestroy(MFrame* frame)
+{
+	assert(frame);
+
+#ifdef _WIN32
+	_aligned_free(frame->pixels);
+#else
+	free(frame->pixels);
+#endif
+
+	*frame = MFrame {};
+}
+
+/**
+ * @brief  ,    :   
+ *           ,     2 (  
+ *            )      SMOOTH_MAX_BAILOUT.
+*/
+bool IsRenderParamsValid(const MRenderParams* params)
+{
+	assert(params);
+
+	if (!(params->maxIterations > 0 && params->maxIterations <= MAX_ITERATIONS &&
+		  params->bailout >= 2 && (!params->smoothColoring || params->bailout <= SMOOTH_MAX_BAILOUT)))
+		return false;
+
+	switch (params->fractal)
+	{
+		case MFRACTAL_MANDELBROT:
+			return true;
+
+		//       ,   float-refill - :
+		//         .
+		case MFRACTAL_JULIA:
+		case MFRACTAL_BURNING_SHIP:
+			return !IsDistanceKernel(params->kernel) && params->kernel != MKERNEL_FLOAT_SSE_REFILL;
+
+		//      z^2.
+		case MFRACTAL_MULTIBROT:
+			return !IsDistanceKernel(params->kernel) && params->kernel != MKERNEL_FLOAT_SSE_REFILL &&
+				   !params->smoothColoring &&
+				   params->power >= MIN_MULTIBROT_POWER && params->power <= MAX_MULTIBROT_POWER;
+
+		default:
+			return false;
+	}
+}
+
+/**
+ * @brief ,             .
+*/
+bool IsSameRenderParams(const MRenderParams* a, const MRenderParams* b)
+{
+	assert(a);
+	assert(b);
+
+	return a->kernel              == b->kernel              &&
+		   a->maxIterations       == b->maxIterations       &&
+		   a->bailout             == b->bailout             &&
+		   a->interiorCheck       == b->interiorCheck       &&
+		   a->periodCheck         == b->periodCheck         &&
+		   a->seriesApproximation == b->seriesApproximation &&
+		   a->smoothColoring      == b->smoothColoring      &&
+		   a->fractal             == b->fractal             &&
+		   (a->fractal != MFRACTAL_JULIA     || (a->juliaX == b->juliaX && a->juliaY == b->juliaY)) &&
+		   (a->fractal != MFRACTAL_MULTIBROT || a->power == b->power);
+}
+
+/**
+ * @brief         .
+ *           TXLib,     .
+ *
+ * @param frame       MAX_FRAME_SIZE.
+ * @param map       .
+ * @param params     .
+ *
+ * @return false,     ,  
+ *         (IsRenderParamsValid)    .
+*/
+bool RenderMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params)
+{
+	assert(frame);
+	assert(map);
+	assert(params);
+
+	const MTile tile =
+	{
+		0,
+		0,
+		frame->width,
+		frame->height
+	};
+
+	return RenderMandelbrotTile(frame, map, params, &tile);
+}
+
+/**
+ * @brief    .      ,
+ *         ,   ,   ,  .
+ *
+ * @return false,         .
+*/
+bool RenderMandelbrotTile(const MFrame* frame, const MRect* map, const MRenderParams* params,
+						  const MTile* tile)
+{
+	assert(frame);
+	assert(map);
+	assert(params);
+	assert(tile);
+	assert(tile->x0 + tile->width  <= frame->width);
+	assert(tile->y0 + tile->height <= frame->height);
+
+	const MKernel kernel = params->kernel;
+
+	if (kernel == MKERNEL_DOUBLE)
+	{
+		MRenderParams resolved = *params;
+		resolved.kernel = GetDoubleKernel(frame, map);
+
+		return RenderMandelbrotTile(frame, map, &resolved, tile);
+	}
+
+	if (!IsKernelSupported(kernel) || !IsRenderParamsValid(params))
+		return false;
+
+	//       :     ,
+	//         (. IterTileCreate).
+	const size_t kernelWidth = GetKernelWidth(kernel);
+
+	MTile renderTile = *tile;
+	renderTile.width = (tile->width + kernelWidth - 1) / kernelWidth * kernelWidth;
+
+	//     ,     .
+	MIterTile iterTile = {};
+
+	if (!IterTileCreate(&iterTile, frame, params, tile, renderTile.width))
+		return false;
+
+	if (params->fractal != MFRACTAL_MANDELBROT)
+	{
+		RenderFractalTile(frame, map, params, &renderTile, &iterTile);
+		IterTileFinish(&iterTile, frame, tile);
+
+		return true;
+	}
+
+	switch (kernel)
+	{
+		case MKERNEL_SIMPLE:
+			RenderSimpleMandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_SSE:
+			RenderSSEMandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_FLOAT_SSE:
+			RenderFloatSSEMandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_FLOAT_SSE_REFILL:
+			RenderFloatSSERefillMandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_AVX2:
+			RenderAVX2Mandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_AVX512:
+			RenderAVX512Mandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_DD_SSE:
+			RenderDDSSEMandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_DD_AVX2:
+			RenderDDAVX2Mandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_DE_SSE:
+			RenderDistanceSSEMandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		case MKERNEL_DE_AVX2:
+			RenderDistanceAVX2Mandelbrot(frame, map, params, &renderTile, &iterTile);
+			break;
+
+		default:
+			if (iterTile.owned)
+				free(iterTile.iterNums);
+
+			return false;
+	}
+
+	IterTileFinish(&iterTile, frame, tile);
+
+	return true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,264 @@
+#ifndef MANDELBROT_RENDER_H_
+#define MANDELBROT_RENDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+typedef unsigned char BYTE;
+
+struct RGBQUAD
+{
+	BYTE rgbBlue;
+	BYTE rgbGreen;
+	BYTE rgbRed;
+	BYTE rgbReserved;
+};
+#endif
+
+struct MRect
+{
+	double minX;
+	double maxX;
+
+	double minY;
+	double maxY;
+};
+
+struct MFrame
+{
+	RGBQUAD*  pixels;
+
+	size_t    width;
+	size_t    height;
+
+	//        ,   width:  y   pixels + y * stride.
+	size_t    stride;
+
+	//    (stride * height)    ;   nullptr.
+	uint32_t* iterNums;
+
+	//       1/65536 (stride * height); nullptr -  .
+	uint16_t* fractions;
+
+	//       (stride * height)     ;
+	//   ,    .   nullptr.
+	float*    distances;
+};
+
+struct MTile
+{
+	size_t x0;
+	size_t y0;
+
+	size_t width;
+	size_t height;
+};
+
+//      :  y    iterNums + y * stride.
+struct MIterTile
+{
+	uint32_t* iterNums;
+
+	//          ; nullptr -    .
+	uint16_t* fractions;
+	float*    distances;
+
+	size_t    stride;
+
+	//      :          .
+	bool      owned;
+};
+
+enum MKernel
+{
+	MKERNEL_SIMPLE,
+	MKERNEL_SSE,
+	MKERNEL_FLOAT_SSE,
+	MKERNEL_FLOAT_SSE_REFILL,
+	MKERNEL_AVX2,
+	MKERNEL_AVX512,
+
+	// double-double (106 )   ,  double   .
+	MKERNEL_DD_SSE,
+	MKERNEL_DD_AVX2,
+
+	//    MKERNEL_SSE / MKERNEL_AVX2    dz/dc:
+	//        .
+	MKERNEL_DE_SSE,
+	MKERNEL_DE_AVX2,
+
+	//   double ,    ,
+	//  double-double,   double    .
+	MKERNEL_DOUBLE
+};
+
+//  . ,  MFRACTAL_MANDELBROT,   
+// (FractalKernel.h)  double     .
+enum MFractal
+{
+	MFRACTAL_MANDELBROT,   // z^2 + c, z0 = c -  
+	MFRACTAL_JULIA,        // z^2 + c, z0 -  , c = (juliaX, juliaY)
+	MFRACTAL_BURNING_SHIP, // (|x| + i|y|)^2 + c
+	MFRACTAL_MULTIBROT     // z^power + c
+};
+
+//     .
+const size_t MAX_FRAME_SIZE         = 16384;
+
+//   ,  FrameCreate,    ,   
+//  ,  FRAME_ALIGNMENT :       
+//    AVX-512.
+const size_t FRAME_ROW_ALIGNMENT    = 16;
+const size_t FRAME_ALIGNMENT        = 64;
+
+const size_t DEFAULT_MAX_ITERATIONS = 255;
+const double DEFAULT_BAILOUT        = 10;
+
+//   float  - 32-.
+const size_t MAX_ITERATIONS         = 0x7FFFFFFF;
+
+//         float,  R^4    .
+const double SMOOTH_MAX_BAILOUT     = 1e9;
+
+//     ,      .
+const double DISTANCE_SHADE_PIXELS  = 16;
+
+//  MFRACTAL_MULTIBROT,    .
+const unsigned MIN_MULTIBROT_POWER  = 3;
+const unsigned MAX_MULTIBROT_POWER  = 8;
+
+// c    .
+const double DEFAULT_JULIA_X        = -0.8;
+const double DEFAULT_JULIA_Y        = 0.156;
+
+//   ( max(1, |c|)),   MKERNEL_DOUBLE  double-double:
+//   ,  ,    .
+const double DOUBLE_MIN_RELATIVE_STEP = 1024 * 2.220446049250313e-16;
+
+struct MRenderParams
+{
+	MKernel kernel;
+
+	size_t  maxIterations;
+
+	// ,        (  2).
+	double  bailout;
+
+	//         2.
+	bool    interiorCheck;
+
+	//  ,      ( ).
+	bool    periodCheck;
+
+	//     (    ).
+	bool    seriesApproximation;
+
+	//  :        |z|   .
+	bool    smoothColoring;
+
+	// ;   -  .
+	MFractal fractal;
+
+	//  c  .
+	double  juliaX;
+	double  juliaY;
+
+	//  z  MFRACTAL_MULTIBROT.
+	unsigned power;
+};
+
+void RenderSimpleMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							const MIterTile* iterTile);
+
+void RenderSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+						 const MIterTile* iterTile);
+
+void RenderFloatSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							  const MIterTile* iterTile);
+
+void RenderFloatSSERefillMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+									const MIterTile* iterTile);
+
+void RenderAVX2Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+						  const MIterTile* iterTile);
+
+void RenderAVX512Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							const MIterTile* iterTile);
+
+void RenderDDSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+						   const MIterTile* iterTile);
+
+void RenderDDAVX2Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+							const MIterTile* iterTile);
+
+void RenderDistanceSSEMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								 const MIterTile* iterTile);
+
+void RenderDistanceAVX2Mandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+								  const MIterTile* iterTile);
+
+void RenderFractalTile(const MFrame* frame, const MRect* map, const MRenderParams* params, const MTile* tile,
+					   const MIterTile* iterTile);
+
+void CalcPointsSSE(const double* pointsX, const double* pointsY, const size_t count,
+				   const MRenderParams* params, uint32_t* iterNums);
+
+void CalcPointsAVX2(const double* pointsX, const double* pointsY, const size_t count,
+					const MRenderParams* params, uint32_t* iterNums);
+
+bool IsKernelSupported(const MKernel kernel);
+
+size_t GetKernelWidth(const MKernel kernel);
+
+const char* GetKernelName(const MKernel kernel);
+
+const char* GetFractalName(const MFractal fractal);
+
+bool IsDoublePrecisionEnough(const MFrame* frame, const MRect* map);
+
+MKernel GetDoubleKernel(const MFrame* frame, const MRect* map);
+
+bool IsRenderParamsValid(const MRenderParams* params);
+
+bool IsSameRenderParams(const MRenderParams* a, const MRenderParams* b);
+
+RGBQUAD GetIterColor(const size_t iterNum);
+
+float GetSmoothScale(const MRenderParams* params);
+
+void GetSmoothFractions(const float* escapeR2, const size_t count, const float smoothScale, uint16_t* fractions);
+
+bool IsDistanceKernel(const MKernel kernel);
+
+MKernel GetDistanceKernel(const MFrame* frame);
+
+void GetDistanceEstimates(const float* escapeR2, const float* ratios, const size_t count, const double pixelSize,
+						  float* distances);
+
+void ColorizeDistances(const float* distances, RGBQUAD* pixels, const size_t count);
+
+void ColorizeIterations(const uint32_t* iterNums, const uint16_t* fractions, RGBQUAD* pixels, const size_t count);
+
+bool ColorizeFrame(const MFrame* frame);
+
+size_t GetFrameStride(const size_t width);
+
+bool FrameCreate(MFrame* frame, const size_t width, const size_t height, const bool iterations,
+				 const bool fractions, const bool distances);
+
+void FrameDestroy(MFrame* frame);
+
+bool IterTileCreate(MIterTile* iterTile, const MFrame* frame, const MRenderParams* params, const MTile* tile,
+					const size_t renderWidth);
+
+void IterTileFinish(MIterTile* iterTile, const MFrame* frame, const MTile* tile);
+
+bool RenderMandelbrot(const MFrame* frame, const MRect* map, const MRenderParams* params);
+
+bool RenderMandelbrotTile(const MFrame* frame, const MRect* map, const MRenderParams* params,
+						  const MTile* tile);
+
+#endif
\ No newline at end of file
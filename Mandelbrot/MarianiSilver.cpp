@@ -0,0 +1,348 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+#include "MarianiSilver.h"
+
+#include "ParallelRender.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//       /       .
+const uint32_t ITER_UNKNOWN = UINT32_MAX;
+const uint32_t ITER_QUEUED  = UINT32_MAX - 1;
+
+struct MSubdivisionTile
+{
+	const MRenderParams* params;
+	const MTile*         tile;
+
+	MKernel              kernel;
+
+	double               minX;
+	double               maxY;
+	double               xMapStep;
+	double               yMapStep;
+
+	//    ,   .
+	uint32_t*            iterNums;
+
+	//    :  ,    iterNums  .
+	double*              pointsX;
+	double*              pointsY;
+	size_t*              pointPixels;
+	uint32_t*            pointIters;
+	size_t               pointCount;
+};
+
+struct MSubdivisionJob
+{
+	const MFrame*        frame;
+	const MRect*         map;
+
+	MRenderParams        params;
+
+	// -   :      .
+	std::atomic<bool>    failed;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static void QueuePixel(MSubdivisionTile* ctx, const size_t x, const size_t y);
+
+static void FlushPixels(MSubdivisionTile* ctx);
+
+static void SubdivideRect(MSubdivisionTile* ctx, const size_t x0, const size_t y0,
+						  const size_t width, const size_t height);
+
+static void RenderMarianiSilverTileFunc(void* context, const MTile* tile);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief   (  )  ,       .
+ *            ,    ,  
+ *            .
+*/
+static void QueuePixel(MSubdivisionTile* ctx, const size_t x, const size_t y)
+{
+	assert(ctx);
+
+	const size_t pixel = y * ctx->tile->width + x;
+
+	if (ctx->iterNums[pixel] != ITER_UNKNOWN)
+		return;
+
+	ctx->iterNums[pixel] = ITER_QUEUED;
+
+	const double xIndex = (double)(ctx->tile->x0 + x);
+	const double yIndex = (double)(ctx->tile->y0 + y);
+
+	// RenderAVX2Mandelbrot    FMA.
+	if (ctx->kernel == MKERNEL_AVX2)
+	{
+		ctx->pointsX[ctx->pointCount] = fma(xIndex, ctx->xMapStep, ctx->minX);
+		ctx->pointsY[ctx->pointCount] = fma(-yIndex, ctx->yMapStep, ctx->maxY);
+	}
+	else
+	{
+		ctx->pointsX[ctx->pointCount] = ctx->minX + xIndex * ctx->xMapStep;
+		ctx->pointsY[ctx->pointCount] = ctx->maxY - yIndex * ctx->yMapStep;
+	}
+
+	ctx->pointPixels[ctx->pointCount] = pixel;
+	ctx->pointCount++;
+}
+
+/**
+ * @brief         .
+*/
+static void FlushPixels(MSubdivisionTile* ctx)
+{
+	assert(ctx);
+
+	if (ctx->pointCount == 0)
+		return;
+
+	if (ctx->kernel == MKERNEL_AVX2)
+		CalcPointsAVX2(ctx->pointsX, ctx->pointsY, ctx->pointCount, ctx->params, ctx->pointIters);
+	else
+		CalcPointsSSE(ctx->pointsX, ctx->pointsY, ctx->pointCount, ctx->params, ctx->pointIters);
+
+	for (size_t st = 0; st < ctx->pointCount; st++)
+		ctx->iterNums[ctx->pointPixels[st]] = ctx->pointIters[st];
+
+	ctx->pointCount = 0;
+}
+
+/**
+ * @brief   -    (  ):
+ *         ;           ,
+ *            .    
+ *          ,   (  )   .
+ *
+ *            :       ,
+ *                .  
+ *         :  ,  ,   
+ *        , .
+*/
+static void SubdivideRect(MSubdivisionTile* ctx, const size_t x0, const size_t y0,
+						  const size_t width, const size_t height)
+{
+	assert(ctx);
+	assert(width > 0 && height > 0);
+
+	const size_t x1 = x0 + width  - 1;
+	const size_t y1 = y0 + height - 1;
+
+	for (size_t x = x0; x <= x1; x++)
+	{
+		QueuePixel(ctx, x, y0);
+		QueuePixel(ctx, x, y1);
+	}
+
+	for (size_t y = y0 + 1; y < y1; y++)
+	{
+		QueuePixel(ctx, x0, y);
+		QueuePixel(ctx, x1, y);
+	}
+
+	FlushPixels(ctx);
+
+	if (width <= 2 || height <= 2)
+		return;
+
+	const size_t    stride   = ctx->tile->width;
+	const uint32_t* iterNums = ctx->iterNums;
+	const uint32_t  border   = iterNums[y0 * stride + x0];
+
+	bool uniform = true;
+
+	for (size_t x = x0; x <= x1 && uniform; x++)
+		uniform = iterNums[y0 * stride + x] == border && iterNums[y1 * stride + x] == border;
+
+	for (size_t y = y0 + 1; y < y1 && uniform; y++)
+		uniform = iterNums[y * stride + x0] == border && iterNums[y * stride + x1] == border;
+
+	if (uniform)
+	{
+		for (size_t y = y0 + 1; y < y1; y++)
+		{
+			for (size_t x = x0 + 1; x < x1; x++)
+				ctx->iterNums[y * stride + x] = border;
+		}
+
+		return;
+	}
+
+	if (width < SUBDIVISION_MIN_SIZE || height < SUBDIVISION_MIN_SIZE)
+	{
+		for (size_t y = y0 + 1; y < y1; y++)
+		{
+			for (size_t x = x0 + 1; x < x1; x++)
+				QueuePixel(ctx, x, y);
+		}
+
+		FlushPixels(ctx);
+		return;
+	}
+
+	if (width >= height)
+	{
+		const size_t half = width / 2;
+
+		SubdivideRect(ctx, x0,        y0, half + 1,     height);
+		SubdivideRect(ctx, x0 + half, y0, width - half, height);
+	}
+	else
+	{
+		const size_t half = height / 2;
+
+		SubdivideRect(ctx, x0, y0,        width, half + 1);
+		SubdivideRect(ctx, x0, y0 + half, width, height - half);
+	}
+}
+
+static void RenderMarianiSilverTileFunc(void* context, const MTile* tile)
+{
+	assert(context);
+	assert(tile);
+
+	MSubdivisionJob* job = (MSubdivisionJob*)context;
+
+	if (!RenderMarianiSilverTile(job->frame, job->map, &job->params, tile))
+		job->failed = true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief    : AVX2,      double 
+ *         SSE,  SSE.    double   float .
+*/
+MKernel GetSubdivisionKernel(const MKernel kernel)
+{
+	const bool wide = kernel == MKERNEL_AVX2 || kernel == MKERNEL_AVX512 || kernel == MKERNEL_DD_AVX2 ||
+					  kernel == MKERNEL_DE_AVX2 || kernel == MKERNEL_DOUBLE;
+
+	if (wide && IsKernelSupported(MKERNEL_AVX2))
+		return MKERNEL_AVX2;
+
+	return MKERNEL_SSE;
+}
+
+/**
+ * @brief     -  (. SubdivideRect). 
+ *                (CalcPointsSSE/AVX2),
+ *             .
+ *
+ * @return false,       .
+*/
+bool RenderMarianiSilverTile(const MFrame* frame, const MRect* map, const MRenderParams* params,
+							 const MTile* tile)
+{
+	assert(frame);
+	assert(frame->pixels);
+	assert(map);
+	assert(params);
+	assert(tile);
+	assert(tile->x0 + tile->width  <= frame->width);
+	assert(tile->y0 + tile->height <= frame->height);
+
+	// CalcPointsSSE/AVX2   z^2 + c  c -  .
+	if (!IsRenderParamsValid(params) || params->fractal != MFRACTAL_MANDELBROT)
+		return false;
+
+	const size_t pixelCount = tile->width * tile->height;
+
+	MSubdivisionTile ctx =
+	{
+		params,
+		tile,
+		GetSubdivisionKernel(params->kernel),
+		map->minX,
+		map->maxY,
+		(map->maxX - map->minX) / frame->width,
+		(map->maxY - map->minY) / frame->height,
+		(uint32_t*)malloc(pixelCount * sizeof(uint32_t)),
+		(double*)  malloc(pixelCount * sizeof(double)),
+		(double*)  malloc(pixelCount * sizeof(double)),
+		(size_t*)  malloc(pixelCount * sizeof(size_t)),
+		(uint32_t*)malloc(pixelCount * sizeof(uint32_t)),
+		0
+	};
+
+	bool allocated = ctx.iterNums && ctx.pointsX && ctx.pointsY && ctx.pointPixels && ctx.pointIters;
+
+	if (allocated)
+	{
+		for (size_t st = 0; st < pixelCount; st++)
+			ctx.iterNums[st] = ITER_UNKNOWN;
+
+		if (pixelCount > 0)
+			SubdivideRect(&ctx, 0, 0, tile->width, tile->height);
+
+		for (size_t y = 0; y < tile->height; y++)
+		{
+			const uint32_t* iters = ctx.iterNums + y * tile->width;
+			const size_t    start = (tile->y0 + y) * frame->stride + tile->x0;
+
+			if (frame->iterNums)
+				memcpy(frame->iterNums + start, iters, tile->width * sizeof(uint32_t));
+
+			//        ,   .
+			if (frame->fractions)
+				memset(frame->fractions + start, 0, tile->width * sizeof(uint16_t));
+
+			ColorizeIterations(iters, nullptr, frame->pixels + start, tile->width);
+		}
+	}
+
+	free(ctx.iterNums);
+	free(ctx.pointsX);
+	free(ctx.pointsY);
+	free(ctx.pointPixels);
+	free(ctx.pointIters);
+
+	return allocated;
+}
+
+/**
+ * @brief     - ;  - 
+ *          -   .     
+ *            ,      
+ *         .
+ *
+ * @return false,         .
+*/
+bool RenderMarianiSilverParallel(MThreadPool* pool, const MFrame* frame, const MRect* map,
+								 const MRenderParams* params, const size_t tileSize)
+{
+	assert(pool);
+	assert(frame);
+	assert(map);
+	assert(params);
+
+	if (!IsRenderParamsValid(params) || params->fractal != MFRACTAL_MANDELBROT || tileSize == 0)
+		return false;
+
+	MSubdivisionJob job;
+
+	job.frame  = frame;
+	job.map    = map;
+	job.params = *params;
+	job.failed = false;
+
+	RenderTilesParallel(pool, frame, tileSize, RenderMarianiSilverTileFunc, &job);
+
+	return !job.failed;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
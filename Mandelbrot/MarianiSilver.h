@@ -0,0 +1,19 @@
+#ifndef MARIANI_SILVER_H_
+#define MARIANI_SILVER_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+// ,     ,  .
+const size_t SUBDIVISION_MIN_SIZE = 6;
+
+MKernel GetSubdivisionKernel(const MKernel kernel);
+
+bool RenderMarianiSilverTile(const MFrame* frame, const MRect* map, const MRenderParams* params,
+							 const MTile* tile);
+
+bool RenderMarianiSilverParallel(MThreadPool* pool, const MFrame* frame, const MRect* map,
+								 const MRenderParams* params, const size_t tileSize);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include <assert.h>
+#include <atomic>
+
+#include "ParallelRender.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+struct MTileJob
+{
+	MTile         region;
+
+	size_t        tileSize;
+	size_t        tilesX;
+
+	MTileFunc     func;
+	void*         context;
+};
+
+struct MMandelbrotJob
+{
+	const MFrame*     frame;
+	const MRect*      map;
+
+	MRenderParams     params;
+
+	// -   :       .
+	std::atomic<bool> failed;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static void RenderTileTask(void* context, const size_t taskIndex, const size_t threadIndex);
+
+static void RenderMandelbrotTileFunc(void* context, const MTile* tile);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static void RenderTileTask(void* context, const size_t taskIndex, const size_t threadIndex)
+{
+	assert(context);
+
+	(void)threadIndex;
+
+	const MTileJob* job    = (const MTileJob*)context;
+	const MTile*    region = &job->region;
+
+	MTile tile =
+	{
+		region->x0 + (taskIndex % job->tilesX) * job->tileSize,
+		region->y0 + (taskIndex / job->tilesX) * job->tileSize,
+		job->tileSize,
+		job->tileSize
+	};
+
+	if (tile.x0 + tile.width > region->x0 + region->width)
+		tile.width = region->x0 + region->width - tile.x0;
+
+	if (tile.y0 + tile.height > region->y0 + region->height)
+		tile.height = region->y0 + region->height - tile.y0;
+
+	job->func(job->context, &tile);
+}
+
+static void RenderMandelbrotTileFunc(void* context, const MTile* tile)
+{
+	assert(context);
+	assert(tile);
+
+	MMandelbrotJob* job = (MMandelbrotJob*)context;
+
+	if (!RenderMandelbrotTile(job->frame, job->map, &job->params, tile))
+		job->failed = true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief      (       )
+ *             func   .
+*/
+void RenderTilesParallel(MThreadPool* pool, const MFrame* frame, const size_t tileSize,
+						 MTileFunc func, void* context)
+{
+	assert(frame);
+
+	const MTile region =
+	{
+		0,
+		0,
+		frame->width,
+		frame->height
+	};
+
+	RenderRegionTilesParallel(pool, &region, tileSize, func, context);
+}
+
+/**
+ * @brief  ,   RenderTilesParallel,      region .
+*/
+void RenderRegionTilesParallel(MThreadPool* pool, const MTile* region, const size_t tileSize,
+							   MTileFunc func, void* context)
+{
+	assert(pool);
+	assert(region);
+	assert(func);
+	assert(tileSize > 0);
+
+	MTileJob job =
+	{
+		*region,
+		tileSize,
+		(region->width + tileSize - 1) / tileSize,
+		func,
+		context
+	};
+
+	const size_t tilesY = (region->height + tileSize - 1) / tileSize;
+
+	ThreadPoolRun(pool, RenderTileTask, &job, job.tilesX * tilesY);
+}
+
+/**
+ * @brief          .
+ *            (  -  ,
+ *         - 1-2),  ,   ,   .
+ *
+ * @param tileSize    .      .
+ *
+ * @return false,    ,       ,
+ *                .
+*/
+bool RenderMandelbrotParallel(MThreadPool* pool, const MFrame* frame, const MRect* map,
+							  const MRenderParams* params, const size_t tileSize)
+{
+	assert(frame);
+
+	const MTile region =
+	{
+		0,
+		0,
+		frame->width,
+		frame->height
+	};
+
+	return RenderMandelbrotRegionParallel(pool, frame, map, params, &region, tileSize);
+}
+
+/**
+ * @brief  ,   RenderMandelbrotParallel,     region.
+ *             .
+ *
+ * @return false,    ,      ,
+ *                .
+*/
+bool RenderMandelbrotRegionParallel(MThreadPool* pool, const MFrame* frame, const MRect* map,
+									const MRenderParams* params, const MTile* region, const size_t tileSize)
+{
+	assert(pool);
+	assert(frame);
+	assert(map);
+	assert(params);
+	assert(region);
+	assert(region->x0 + region->width  <= frame->width);
+	assert(region->y0 + region->height <= frame->height);
+
+	MKernel kernel = params->kernel;
+
+	if (kernel == MKERNEL_DOUBLE)
+		kernel = GetDoubleKernel(frame, map);
+
+	const size_t kernelWidth = GetKernelWidth(kernel);
+
+	//          (. RenderMandelbrotTile).
+	if (!IsKernelSupported(kernel) || !IsRenderParamsValid(params) || tileSize == 0 || tileSize % kernelWidth != 0)
+		return false;
+
+	MMandelbrotJob job;
+
+	job.frame         = frame;
+	job.map           = map;
+	job.params        = *params;
+	job.params.kernel = kernel;
+	job.failed        = false;
+
+	RenderRegionTilesParallel(pool, region, tileSize, RenderMandelbrotTileFunc, &job);
+
+	return !job.failed;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
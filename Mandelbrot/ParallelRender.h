@@ -0,0 +1,24 @@
+#ifndef PARALLEL_RENDER_H_
+#define PARALLEL_RENDER_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+const size_t DEFAULT_TILE_SIZE = 64;
+
+typedef void (*MTileFunc)(void* context, const MTile* tile);
+
+void RenderTilesParallel(MThreadPool* pool, const MFrame* frame, const size_t tileSize,
+						 MTileFunc func, void* context);
+
+void RenderRegionTilesParallel(MThreadPool* pool, const MTile* region, const size_t tileSize,
+							   MTileFunc func, void* context);
+
+bool RenderMandelbrotParallel(MThreadPool* pool, const MFrame* frame, const MRect* map,
+							  const MRenderParams* params, const size_t tileSize);
+
+bool RenderMandelbrotRegionParallel(MThreadPool* pool, const MFrame* frame, const MRect* map,
+									const MRenderParams* params, const MTile* region, const size_t tileSize);
+
+#endif
\ No newline at end of file
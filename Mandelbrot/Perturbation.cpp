@@ -0,0 +1,506 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <emmintrin.h>
+#include <atomic>
+
+#include "Perturbation.h"
+
+#include "FixedPoint.h"
+#include "KernelStats.h"
+#include "ParallelRender.h"
+#include "SeriesApproximation.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+struct MDeepJob
+{
+	const MFrame*          frame;
+	const MDeepView*       view;
+	const MReferenceOrbit* orbit;
+	const MSeries*         series;
+	const MRenderParams*   params;
+
+	MKernel                kernel;
+
+	// -   :       .
+	std::atomic<bool>      failed;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static size_t GetLimbCount(const MDeepView* view, const MFrame* frame);
+
+static bool IsDeepRenderValid(const MFrame* frame, const MRenderParams* params, const size_t tileSize);
+
+static void RenderDeepTileFunc(void* context, const MTile* tile);
+
+static void SeriesEvaluateSSE(const MSeries* series, const size_t index, const __m128d dcX, const __m128d dcY,
+							  __m128d* dzX, __m128d* dzY);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief  32- ,   :    
+ *             64     .
+ *
+ * @return 0,       .
+*/
+static size_t GetLimbCount(const MDeepView* view, const MFrame* frame)
+{
+	assert(view);
+	assert(frame);
+
+	const double pixelSize = fmin(view->width / frame->width, view->height / frame->height);
+
+	if (!(pixelSize >= MIN_DEEP_PIXEL_SIZE))
+		return 0;
+
+	const double fractionBits = 64 - log2(pixelSize);
+	const size_t limbCount    = 1 + (size_t)ceil(fractionBits / 32);
+
+	return limbCount <= FIXED_MAX_LIMBS ? limbCount : 0;
+}
+
+static bool IsDeepRenderValid(const MFrame* frame, const MRenderParams* params, const size_t tileSize)
+{
+	assert(frame);
+	assert(params);
+
+	const size_t kernelWidth = GetKernelWidth(GetPerturbationKernel(params->kernel));
+
+	return IsRenderParamsValid(params) && params->fractal == MFRACTAL_MANDELBROT && tileSize != 0 &&
+		   tileSize % kernelWidth == 0;
+}
+
+static void RenderDeepTileFunc(void* context, const MTile* tile)
+{
+	assert(context);
+	assert(tile);
+
+	MDeepJob* job = (MDeepJob*)context;
+
+	size_t skip = 1;
+
+	if (job->series)
+		skip = SeriesGetSkip(job->series, job->orbit, job->view, job->frame, job->params, tile);
+
+	//      ,   RenderMandelbrotTile.
+	const size_t kernelWidth = GetKernelWidth(job->kernel);
+
+	MTile renderTile = *tile;
+	renderTile.width = (tile->width + kernelWidth - 1) / kernelWidth * kernelWidth;
+
+	MIterTile iterTile = {};
+
+	if (!IterTileCreate(&iterTile, job->frame, job->params, tile, renderTile.width))
+	{
+		job->failed = true;
+		return;
+	}
+
+	if (job->kernel == MKERNEL_AVX2)
+		RenderPerturbationAVX2(job->frame, job->view, job->orbit, job->series, skip, job->params, &renderTile,
+							   &iterTile);
+	else
+		RenderPerturbationSSE(job->frame, job->view, job->orbit, job->series, skip, job->params, &renderTile,
+							  &iterTile);
+
+	IterTileFinish(&iterTile, job->frame, tile);
+}
+
+/**
+ * @brief SeriesEvaluate   .
+*/
+static void SeriesEvaluateSSE(const MSeries* series, const size_t index, const __m128d dcX, const __m128d dcY,
+							  __m128d* dzX, __m128d* dzY)
+{
+	assert(series);
+	assert(dzX);
+	assert(dzY);
+
+	alignas(16) double ptr_dcX[2] = {};
+	alignas(16) double ptr_dcY[2] = {};
+	alignas(16) double ptr_dzX[2] = {};
+	alignas(16) double ptr_dzY[2] = {};
+
+	_mm_store_pd(ptr_dcX, dcX);
+	_mm_store_pd(ptr_dcY, dcY);
+
+	for (size_t lane = 0; lane < 2; lane++)
+		SeriesEvaluate(series, index, ptr_dcX[lane], ptr_dcY[lane], &ptr_dzX[lane], &ptr_dzY[lane]);
+
+	*dzX = _mm_load_pd(ptr_dzX);
+	*dzY = _mm_load_pd(ptr_dzY);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief        ,    .
+ *            double:      Z_n
+ *          Z_n,     .
+ *
+ *                maxIterations + 1 .  
+ *            :   Z(m + 2) .
+ *
+ * @return false,    ,       .
+*/
+bool ReferenceOrbitCreate(MReferenceOrbit* orbit, const MDeepView* view, const MFrame* frame,
+						  const MRenderParams* params)
+{
+	assert(orbit);
+	assert(view);
+	assert(view->centerX);
+	assert(view->centerY);
+	assert(frame);
+	assert(params);
+
+	*orbit = MReferenceOrbit {};
+
+	const size_t limbCount = GetLimbCount(view, frame);
+
+	if (limbCount == 0)
+		return false;
+
+	MFixed centerX = {};
+	MFixed centerY = {};
+
+	if (!FixedFromString(&centerX, view->centerX, limbCount) ||
+		!FixedFromString(&centerY, view->centerY, limbCount))
+		return false;
+
+	const size_t capacity = params->maxIterations + 2;
+
+	orbit->x = (double*)calloc(capacity + 1, sizeof(double));
+	orbit->y = (double*)calloc(capacity + 1, sizeof(double));
+
+	if (!orbit->x || !orbit->y)
+	{
+		ReferenceOrbitDestroy(orbit);
+		return false;
+	}
+
+	MFixed x  = {};
+	MFixed y  = {};
+	MFixed x2 = {};
+	MFixed y2 = {};
+	MFixed xy = {};
+
+	FixedSetZero(&x, limbCount);
+	FixedSetZero(&y, limbCount);
+
+	const double maxR2 = params->bailout * params->bailout;
+
+	orbit->length = 1;
+
+	for (size_t st = 1; st < capacity; st++)
+	{
+		FixedMul(&x2, &x, &x);
+		FixedMul(&y2, &y, &y);
+		FixedMul(&xy, &x, &y);
+
+		// x^2 - y^2 + x0
+		FixedSub(&x, &x2, &y2);
+		FixedAdd(&x, &x, &centerX);
+
+		// 2xy + y0
+		FixedAdd(&y, &xy, &xy);
+		FixedAdd(&y, &y, &centerY);
+
+		orbit->x[st]  = FixedToDouble(&x);
+		orbit->y[st]  = FixedToDouble(&y);
+		orbit->length = st + 1;
+
+		if (orbit->x[st] * orbit->x[st] + orbit->y[st] * orbit->y[st] > maxR2)
+			break;
+	}
+
+	return true;
+}
+
+void ReferenceOrbitDestroy(MReferenceOrbit* orbit)
+{
+	assert(orbit);
+
+	free(orbit->x);
+	free(orbit->y);
+
+	*orbit = MReferenceOrbit {};
+}
+
+/**
+ * @brief     ,  2  double   (SSE2).
+ *          c = C + dc      :
+ *
+ *            dz(n + 1) = (2 Z(n) + dz(n)) dz(n) + dc,   z(n) = Z(n) + dz(n).
+ *
+ *         ,   double,        .
+ *
+ *         -  ,  z(n)   ,  dz(n) - : 
+ *        |z(n)| < |dz(n)|,        (rebasing):
+ *        dz = z(n), Z = Z(0) = 0.   ,    
+ *        (     ).     .
+ *
+ * @param series    (  nullptr,  skip = 1).
+ * @param skip    ,      (. SeriesGetSkip).
+*/
+void RenderPerturbationSSE(const MFrame* frame, const MDeepView* view, const MReferenceOrbit* orbit,
+						   const MSeries* series, const size_t skip, const MRenderParams* params,
+						   const MTile* tile, const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(view);
+	assert(orbit);
+	assert(orbit->length > 1);
+	assert(skip >= 1 && skip + 1 < orbit->length);
+	assert(skip == 1 || series);
+	assert(params);
+	assert(tile);
+	assert(tile->width % 2 == 0);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double xMapStep = view->width  / imageWidth;
+	double yMapStep = view->height / imageHeight;
+
+	const double* refX = orbit->x;
+	const double* refY = orbit->y;
+	const size_t  last = orbit->length - 1;
+
+	const size_t  maxIterations = params->maxIterations;
+
+	const __m128d laneIndex = _mm_set_pd(1, 0);
+	const __m128d maxR2     = _mm_set1_pd(params->bailout * params->bailout);
+
+	const bool    smooth      = iterTile->fractions != nullptr;
+	const float   smoothScale = GetSmoothScale(params);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		uint32_t* row       = iterTile->iterNums + (yIndex - tile->y0) * iterTile->stride;
+		uint16_t* fractions = smooth ? iterTile->fractions + (yIndex - tile->y0) * iterTile->stride : nullptr;
+
+		const __m128d dcY = _mm_set1_pd(view->height / 2 - yIndex * yMapStep);
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex += 2)
+		{
+			const __m128d dcX = _mm_add_pd(_mm_set1_pd(-view->width / 2),
+										   _mm_mul_pd(_mm_add_pd(_mm_set1_pd((double)xIndex), laneIndex),
+													  _mm_set1_pd(xMapStep)));
+
+			// z(1) = c:   Z(1) = C  dc.
+			__m128d dzX     = dcX;
+			__m128d dzY     = dcY;
+
+			if (skip > 1)
+				SeriesEvaluateSSE(series, skip, dcX, dcY, &dzX, &dzY);
+
+			size_t  refIndex[2] = { skip, skip };
+
+			__m128d refZX   = _mm_set1_pd(refX[skip]);
+			__m128d refZY   = _mm_set1_pd(refY[skip]);
+
+			__m128d active  = _mm_castsi128_pd(_mm_set1_epi32(-1));
+			__m128i iterNum = _mm_set1_epi64x((long long)(skip - 1));
+
+			// |Z + dz|^2   ,   RenderSSEMandelbrot.
+			__m128d escapeR2 = _mm_setzero_pd();
+
+			KERNEL_STATS_VECTOR_BEGIN(stats);
+
+			for (size_t st = skip - 1; st < maxIterations; st++)
+			{
+				__m128d twoZX = _mm_add_pd(_mm_add_pd(refZX, refZX), dzX);
+				__m128d twoZY = _mm_add_pd(_mm_add_pd(refZY, refZY), dzY);
+
+				__m128d nextX =
+					_mm_add_pd(
+						_mm_sub_pd(
+							_mm_mul_pd(twoZX, dzX),
+							_mm_mul_pd(twoZY, dzY)),
+						dcX);
+
+				__m128d nextY =
+					_mm_add_pd(
+						_mm_add_pd(
+							_mm_mul_pd(twoZX, dzY),
+							_mm_mul_pd(twoZY, dzX)),
+						dcY);
+
+				refIndex[0]++;
+				refIndex[1]++;
+
+				refZX = _mm_set_pd(refX[refIndex[1]], refX[refIndex[0]]);
+				refZY = _mm_set_pd(refY[refIndex[1]], refY[refIndex[0]]);
+
+				__m128d zX = _mm_add_pd(refZX, nextX);
+				__m128d zY = _mm_add_pd(refZY, nextY);
+
+				__m128d r2 = _mm_add_pd(_mm_mul_pd(zX, zX), _mm_mul_pd(zY, zY));
+
+				__m128d cmpRes = _mm_and_pd(active, _mm_cmple_pd(r2, maxR2));
+
+				KERNEL_STATS_TRIP(stats, 2, KernelStatsCountBits(_mm_movemask_pd(cmpRes)));
+
+				if (smooth)
+					escapeR2 = _mm_max_pd(escapeR2, _mm_and_pd(active, r2));
+
+				if (_mm_movemask_pd(cmpRes) == 0)
+					break; //     
+
+				iterNum = _mm_sub_epi64(iterNum, _mm_castpd_si128(cmpRes));
+				active  = cmpRes;
+
+				dzX = nextX;
+				dzY = nextY;
+
+				__m128d dz2 = _mm_add_pd(_mm_mul_pd(dzX, dzX), _mm_mul_pd(dzY, dzY));
+
+				int rebaseMask = _mm_movemask_pd(_mm_cmplt_pd(r2, dz2));
+
+				for (size_t lane = 0; lane < 2; lane++)
+				{
+					if (refIndex[lane] == last)
+						rebaseMask |= 1 << lane;
+				}
+
+				if (rebaseMask)
+				{
+					const __m128d mask = _mm_castsi128_pd(_mm_set_epi64x(-(long long)((rebaseMask >> 1) & 1),
+																		 -(long long)(rebaseMask & 1)));
+
+					dzX   = _mm_or_pd(_mm_and_pd(mask, zX), _mm_andnot_pd(mask, dzX));
+					dzY   = _mm_or_pd(_mm_and_pd(mask, zY), _mm_andnot_pd(mask, dzY));
+					refZX = _mm_andnot_pd(mask, refZX);
+					refZY = _mm_andnot_pd(mask, refZY);
+
+					for (size_t lane = 0; lane < 2; lane++)
+					{
+						if (rebaseMask & (1 << lane))
+							refIndex[lane] = 0;
+					}
+				}
+			}
+
+			KERNEL_STATS_VECTOR_END(stats);
+
+			_mm_storel_epi64((__m128i*)(row + xIndex - tile->x0), _mm_shuffle_epi32(iterNum, _MM_SHUFFLE(3, 1, 2, 0)));
+
+			if (smooth)
+			{
+				alignas(16) float escapeR2f[4] = {};
+				_mm_store_ps(escapeR2f, _mm_cvtpd_ps(escapeR2));
+
+				GetSmoothFractions(escapeR2f, 2, smoothScale, fractions + xIndex - tile->x0);
+			}
+		}
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+/**
+ * @brief AVX2 ,      double   SSE.
+ *         float    double:  float
+ *         1e-38 .
+*/
+MKernel GetPerturbationKernel(const MKernel kernel)
+{
+	const bool wide = kernel == MKERNEL_AVX2 || kernel == MKERNEL_AVX512 || kernel == MKERNEL_DD_AVX2 ||
+					  kernel == MKERNEL_DE_AVX2 || kernel == MKERNEL_DOUBLE;
+
+	if (wide && IsKernelSupported(MKERNEL_AVX2))
+		return MKERNEL_AVX2;
+
+	return MKERNEL_SSE;
+}
+
+/**
+ * @brief  ,     ,   :
+ *             ,   -  double SIMD.
+ *            MIN_DEEP_PIXEL_SIZE.
+ *
+ * @return false,            Z(2),
+ *           ,   (   MFRACTAL_MANDELBROT),
+ *                  .
+*/
+bool RenderDeepMandelbrotParallel(MThreadPool* pool, const MFrame* frame, const MDeepView* view,
+								  const MRenderParams* params, const size_t tileSize)
+{
+	assert(pool);
+	assert(frame);
+	assert(view);
+	assert(params);
+
+	if (!IsDeepRenderValid(frame, params, tileSize))
+		return false;
+
+	MReferenceOrbit orbit = {};
+
+	if (!ReferenceOrbitCreate(&orbit, view, frame, params))
+		return false;
+
+	bool rendered = RenderDeepMandelbrotOrbit(pool, frame, view, &orbit, params, tileSize);
+
+	ReferenceOrbitDestroy(&orbit);
+
+	return rendered;
+}
+
+/**
+ * @brief  ,   RenderDeepMandelbrotParallel,     : 
+ *            (,  )    .   
+ *              (ReferenceOrbitCreate    
+ *        )       ;      .
+ *
+ * @return false,    3  (     Z(1))   
+ *         ,        (. RenderDeepMandelbrotParallel).
+*/
+bool RenderDeepMandelbrotOrbit(MThreadPool* pool, const MFrame* frame, const MDeepView* view,
+							   const MReferenceOrbit* orbit, const MRenderParams* params, const size_t tileSize)
+{
+	assert(pool);
+	assert(frame);
+	assert(view);
+	assert(orbit);
+	assert(params);
+
+	//    Z(1)    Z(2):        .
+	if (!IsDeepRenderValid(frame, params, tileSize) || orbit->length < 3 ||
+		!(fmin(view->width / frame->width, view->height / frame->height) >= MIN_DEEP_PIXEL_SIZE))
+		return false;
+
+	MSeries series = {};
+
+	if (params->seriesApproximation && !SeriesCreate(&series, orbit, view))
+		return false;
+
+	MDeepJob job;
+
+	job.frame  = frame;
+	job.view   = view;
+	job.orbit  = orbit;
+	job.series = params->seriesApproximation ? &series : nullptr;
+	job.params = params;
+	job.kernel = GetPerturbationKernel(params->kernel);
+	job.failed = false;
+
+	RenderTilesParallel(pool, frame, tileSize, RenderDeepTileFunc, &job);
+
+	SeriesDestroy(&series);
+
+	return !job.failed;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef PERTURBATION_H_
+#define PERTURBATION_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//      double ( ).
+const double MIN_DEEP_PIXEL_SIZE = 1e-290;
+
+struct MDeepView
+{
+	//   -    .
+	const char* centerX;
+	const char* centerY;
+
+	double      width;
+	double      height;
+};
+
+struct MReferenceOrbit
+{
+	double* x;
+	double* y;
+
+	//   Z_0 = 0, Z_1 = C, ..., Z_(length - 1).
+	size_t  length;
+};
+
+struct MSeries;
+
+bool ReferenceOrbitCreate(MReferenceOrbit* orbit, const MDeepView* view, const MFrame* frame,
+						  const MRenderParams* params);
+
+void ReferenceOrbitDestroy(MReferenceOrbit* orbit);
+
+void RenderPerturbationSSE(const MFrame* frame, const MDeepView* view, const MReferenceOrbit* orbit,
+						   const MSeries* series, const size_t skip, const MRenderParams* params,
+						   const MTile* tile, const MIterTile* iterTile);
+
+void RenderPerturbationAVX2(const MFrame* frame, const MDeepView* view, const MReferenceOrbit* orbit,
+							const MSeries* series, const size_t skip, const MRenderParams* params,
+							const MTile* tile, const MIterTile* iterTile);
+
+MKernel GetPerturbationKernel(const MKernel kernel);
+
+bool RenderDeepMandelbrotParallel(MThreadPool* pool, const MFrame* frame, const MDeepView* view,
+								  const MRenderParams* params, const size_t tileSize);
+
+bool RenderDeepMandelbrotOrbit(MThreadPool* pool, const MFrame* frame, const MDeepView* view,
+							   const MReferenceOrbit* orbit, const MRenderParams* params, const size_t tileSize);
+
+#endif
\ No newline at end of file
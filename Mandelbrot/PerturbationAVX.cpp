@@ -0,0 +1,236 @@
+#include <assert.h>
+#include <immintrin.h>
+
+#include "Perturbation.h"
+
+#include "CpuFeatures.h"
+#include "KernelStats.h"
+#include "SeriesApproximation.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+TARGET_AVX2
+static void SeriesEvaluateAVX2(const MSeries* series, const size_t index, const __m256d dcX, const __m256d dcY,
+							   __m256d* dzX, __m256d* dzY);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief SeriesEvaluate  4 .
+*/
+TARGET_AVX2
+static void SeriesEvaluateAVX2(const MSeries* series, const size_t index, const __m256d dcX, const __m256d dcY,
+							   __m256d* dzX, __m256d* dzY)
+{
+	assert(series);
+	assert(dzX);
+	assert(dzY);
+
+	alignas(32) double ptr_dcX[4] = {};
+	alignas(32) double ptr_dcY[4] = {};
+	alignas(32) double ptr_dzX[4] = {};
+	alignas(32) double ptr_dzY[4] = {};
+
+	_mm256_store_pd(ptr_dcX, dcX);
+	_mm256_store_pd(ptr_dcY, dcY);
+
+	for (size_t lane = 0; lane < 4; lane++)
+		SeriesEvaluate(series, index, ptr_dcX[lane], ptr_dcY[lane], &ptr_dzX[lane], &ptr_dzY[lane]);
+
+	*dzX = _mm256_load_pd(ptr_dzX);
+	*dzY = _mm256_load_pd(ptr_dzY);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief  ,   RenderPerturbationSSE,  4    (AVX2 + FMA).
+ *                (    
+ *         ),  Z(n)   gather.
+ *
+ *        Gather ,  Z(m + 2)    ,  :
+ *             ,         ,
+ *                 .
+*/
+TARGET_AVX2
+void RenderPerturbationAVX2(const MFrame* frame, const MDeepView* view, const MReferenceOrbit* orbit,
+							const MSeries* series, const size_t skip, const MRenderParams* params,
+							const MTile* tile, const MIterTile* iterTile)
+{
+	assert(frame);
+	assert(iterTile);
+	assert(iterTile->iterNums);
+	assert(view);
+	assert(orbit);
+	assert(orbit->length > 1);
+	assert(skip >= 1 && skip + 1 < orbit->length);
+	assert(skip == 1 || series);
+	assert(params);
+	assert(tile);
+	assert(tile->width % 4 == 0);
+
+	const size_t imageHeight = frame->height;
+	const size_t imageWidth  = frame->width;
+
+	double xMapStep = view->width  / imageWidth;
+	double yMapStep = view->height / imageHeight;
+
+	const double* refX = orbit->x;
+	const double* refY = orbit->y;
+
+	const size_t  maxIterations = params->maxIterations;
+
+	const __m256d laneIndex = _mm256_set_pd(3, 2, 1, 0);
+
+	const __m256i packLow   = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+	const __m256d maxR2     = _mm256_set1_pd(params->bailout * params->bailout);
+
+	const __m256i one       = _mm256_set1_epi64x(1);
+	const __m256i two       = _mm256_set1_epi64x(2);
+	const __m256i last      = _mm256_set1_epi64x((long long)(orbit->length - 1));
+
+	// Z(1) = C -        .
+	const __m256d firstX    = _mm256_set1_pd(refX[1]);
+	const __m256d firstY    = _mm256_set1_pd(refY[1]);
+
+	const bool    smooth      = iterTile->fractions != nullptr;
+	const float   smoothScale = GetSmoothScale(params);
+
+	KERNEL_STATS_BEGIN(stats);
+
+	for (size_t yIndex = tile->y0; yIndex < tile->y0 + tile->height; yIndex++)
+	{
+		uint32_t* row       = iterTile->iterNums + (yIndex - tile->y0) * iterTile->stride;
+		uint16_t* fractions = smooth ? iterTile->fractions + (yIndex - tile->y0) * iterTile->stride : nullptr;
+
+		const __m256d dcY = _mm256_set1_pd(view->height / 2 - yIndex * yMapStep);
+
+		for (size_t xIndex = tile->x0; xIndex < tile->x0 + tile->width; xIndex += 4)
+		{
+			const __m256d dcX = _mm256_add_pd(_mm256_set1_pd(-view->width / 2),
+											  _mm256_mul_pd(_mm256_add_pd(_mm256_set1_pd((double)xIndex), laneIndex),
+															_mm256_set1_pd(xMapStep)));
+
+			__m256d dzX      = dcX;
+			__m256d dzY      = dcY;
+
+			if (skip > 1)
+				SeriesEvaluateAVX2(series, skip, dcX, dcY, &dzX, &dzY);
+
+			// Z(m)  Z(m + 1)    m   .
+			__m256i refIndex = _mm256_set1_epi64x((long long)skip);
+
+			__m256d refZX    = _mm256_set1_pd(refX[skip]);
+			__m256d refZY    = _mm256_set1_pd(refY[skip]);
+			__m256d nextZX   = _mm256_set1_pd(refX[skip + 1]);
+			__m256d nextZY   = _mm256_set1_pd(refY[skip + 1]);
+
+			__m256d active   = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+			__m256i iterNum  = _mm256_set1_epi64x((long long)(skip - 1));
+
+			// |Z + dz|^2   ,   RenderAVX2Mandelbrot.
+			__m256d escapeR2 = _mm256_setzero_pd();
+
+			//         ,    
+			//   st + 1.
+			bool    uniform  = true;
+
+			KERNEL_STATS_VECTOR_BEGIN(stats);
+
+			for (size_t st = skip - 1; st < maxIterations; st++)
+			{
+				__m256d aheadZX = _mm256_setzero_pd();
+				__m256d aheadZY = _mm256_setzero_pd();
+
+				if (uniform)
+				{
+					aheadZX = _mm256_broadcast_sd(refX + st + 3);
+					aheadZY = _mm256_broadcast_sd(refY + st + 3);
+				}
+				else
+				{
+					__m256i aheadIndex = _mm256_add_epi64(refIndex, two);
+
+					aheadZX = _mm256_i64gather_pd(refX, aheadIndex, 8);
+					aheadZY = _mm256_i64gather_pd(refY, aheadIndex, 8);
+				}
+
+				// (2 Z + dz) dz + dc
+				__m256d twoZX = _mm256_add_pd(_mm256_add_pd(refZX, refZX), dzX);
+				__m256d twoZY = _mm256_add_pd(_mm256_add_pd(refZY, refZY), dzY);
+
+				__m256d nextX = _mm256_fmsub_pd(twoZX, dzX, _mm256_fmsub_pd(twoZY, dzY, dcX));
+				__m256d nextY = _mm256_fmadd_pd(twoZX, dzY, _mm256_fmadd_pd(twoZY, dzX, dcY));
+
+				__m256d zX = _mm256_add_pd(nextZX, nextX);
+				__m256d zY = _mm256_add_pd(nextZY, nextY);
+
+				__m256d r2 = _mm256_fmadd_pd(zX, zX, _mm256_mul_pd(zY, zY));
+
+				__m256d cmpRes = _mm256_and_pd(active, _mm256_cmp_pd(r2, maxR2, _CMP_LE_OQ));
+
+				KERNEL_STATS_TRIP(stats, 4, KernelStatsCountBits(_mm256_movemask_pd(cmpRes)));
+
+				if (smooth)
+					escapeR2 = _mm256_blendv_pd(escapeR2, r2, active);
+
+				if (_mm256_movemask_pd(cmpRes) == 0)
+					break; //     
+
+				iterNum = _mm256_sub_epi64(iterNum, _mm256_castpd_si256(cmpRes));
+				active  = cmpRes;
+
+				dzX = nextX;
+				dzY = nextY;
+
+				refIndex = _mm256_add_epi64(refIndex, one);
+				refZX    = nextZX;
+				refZY    = nextZY;
+				nextZX   = aheadZX;
+				nextZY   = aheadZY;
+
+				__m256d dz2 = _mm256_fmadd_pd(dzX, dzX, _mm256_mul_pd(dzY, dzY));
+
+				//     : |z| < |dz|   .
+				__m256d rebase =
+					_mm256_or_pd(
+						_mm256_cmp_pd(r2, dz2, _CMP_LT_OQ),
+						_mm256_castsi256_pd(_mm256_cmpeq_epi64(refIndex, last)));
+
+				if (_mm256_movemask_pd(rebase) != 0)
+				{
+					dzX      = _mm256_blendv_pd(dzX, zX, rebase);
+					dzY      = _mm256_blendv_pd(dzY, zY, rebase);
+					refZX    = _mm256_andnot_pd(rebase, refZX);
+					refZY    = _mm256_andnot_pd(rebase, refZY);
+					nextZX   = _mm256_blendv_pd(nextZX, firstX, rebase);
+					nextZY   = _mm256_blendv_pd(nextZY, firstY, rebase);
+					refIndex = _mm256_andnot_si256(_mm256_castpd_si256(rebase), refIndex);
+
+					uniform  = false;
+				}
+			}
+
+			KERNEL_STATS_VECTOR_END(stats);
+
+			_mm_storeu_si128((__m128i*)(row + xIndex - tile->x0),
+							 _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(iterNum, packLow)));
+
+			if (smooth)
+			{
+				alignas(16) float escapeR2f[4] = {};
+				_mm_store_ps(escapeR2f, _mm256_cvtpd_ps(escapeR2));
+
+				GetSmoothFractions(escapeR2f, 4, smoothScale, fractions + xIndex - tile->x0);
+			}
+		}
+	}
+
+	KERNEL_STATS_END(stats);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
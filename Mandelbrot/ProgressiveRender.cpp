@@ -0,0 +1,306 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "ProgressiveRender.h"
+
+#include "ParallelRender.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//  (x0 + i * dx, y0 + j * dy) .
+struct MGrid
+{
+	size_t x0;
+	size_t y0;
+
+	size_t dx;
+	size_t dy;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static bool GetPassGrid(const size_t step, const size_t part, MGrid* grid);
+
+static size_t GetGridRows(const MFrame* frame, const MGrid* grid);
+
+static void SkipFinishedParts(MProgressiveRender* state, const MFrame* frame);
+
+static bool RenderGridBand(MThreadPool* pool, const MFrame* frame, const MRect* map, const MRenderParams* params,
+						   const MGrid* grid, const size_t row, const size_t rows, const size_t blockSize,
+						   const size_t tileSize);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief   ,     part    step.
+ *              ,  step. 
+ *         (step = 4, 2, 1)    :  0 -  
+ *         step,  1 -     .  
+ *          .
+ *
+ * @return false,      .
+*/
+static bool GetPassGrid(const size_t step, const size_t part, MGrid* grid)
+{
+	assert(step > 0);
+	assert(grid);
+
+	if (step == PROGRESSIVE_FIRST_STEP)
+	{
+		*grid = MGrid { 0, 0, step, step };
+		return part == 0;
+	}
+
+	if (part == 0)
+		*grid = MGrid { 0, step, step, 2 * step };
+	else
+		*grid = MGrid { step, 0, 2 * step, 2 * step };
+
+	return part < 2;
+}
+
+static size_t GetGridRows(const MFrame* frame, const MGrid* grid)
+{
+	assert(frame);
+	assert(grid);
+
+	if (grid->y0 >= frame->height)
+		return 0;
+
+	return (frame->height - grid->y0 + grid->dy - 1) / grid->dy;
+}
+
+/**
+ * @brief       ,    
+ *          .
+*/
+static void SkipFinishedParts(MProgressiveRender* state, const MFrame* frame)
+{
+	assert(state);
+	assert(frame);
+
+	while (state->step > 0)
+	{
+		MGrid grid = {};
+
+		if (!GetPassGrid(state->step, state->part, &grid))
+		{
+			state->step /= 2;
+			state->part  = 0;
+			state->row   = 0;
+		}
+		else if (state->row >= GetGridRows(frame, &grid) || grid.x0 >= frame->width)
+		{
+			state->part++;
+			state->row = 0;
+		}
+		else
+			return;
+	}
+}
+
+/**
+ * @brief   row..row + rows - 1       
+ *        dx, dy     :    
+ *         blockSize x blockSize,      .
+ *                ,
+ *          .
+*/
+static bool RenderGridBand(MThreadPool* pool, const MFrame* frame, const MRect* map, const MRenderParams* params,
+						   const MGrid* grid, const size_t row, const size_t rows, const size_t blockSize,
+						   const size_t tileSize)
+{
+	assert(pool);
+	assert(frame);
+	assert(map);
+	assert(params);
+	assert(grid);
+
+	if (grid->x0 >= frame->width || rows == 0)
+		return true;
+
+	const size_t kernelWidth = GetKernelWidth(params->kernel);
+
+	const size_t columns = (frame->width - grid->x0 + grid->dx - 1) / grid->dx;
+	const size_t width   = (columns + kernelWidth - 1) / kernelWidth * kernelWidth;
+
+	const double xMapStep = (map->maxX - map->minX) / frame->width;
+	const double yMapStep = (map->maxY - map->minY) / frame->height;
+
+	const double minX = map->minX + (double)grid->x0 * xMapStep;
+	const double maxY = map->maxY - (double)(grid->y0 + row * grid->dy) * yMapStep;
+
+	const MRect bandMap =
+	{
+		minX,
+		minX + (double)(width * grid->dx) * xMapStep,
+		maxY - (double)(rows * grid->dy) * yMapStep,
+		maxY
+	};
+
+	RGBQUAD*  pixels    = (RGBQUAD*)calloc(width * rows, sizeof(RGBQUAD));
+	uint32_t* iterNums  = frame->iterNums  ? (uint32_t*)calloc(width * rows, sizeof(uint32_t)) : nullptr;
+	uint16_t* fractions = frame->fractions ? (uint16_t*)calloc(width * rows, sizeof(uint16_t)) : nullptr;
+	float*    distances = frame->distances ? (float*)   calloc(width * rows, sizeof(float))    : nullptr;
+
+	const MFrame band = { pixels, width, rows, width, iterNums, fractions, distances };
+
+	if (!pixels || (frame->iterNums && !iterNums) || (frame->fractions && !fractions) ||
+		(frame->distances && !distances) || !RenderMandelbrotParallel(pool, &band, &bandMap, params, tileSize))
+	{
+		free(pixels);
+		free(iterNums);
+		free(fractions);
+		free(distances);
+		return false;
+	}
+
+	//        ,    -  dx  :
+	//     ,   .
+	if (distances)
+	{
+		for (size_t st = 0; st < width * rows; st++)
+			distances[st] *= (float)grid->dx;
+
+		ColorizeDistances(distances, pixels, width * rows);
+	}
+
+	for (size_t yIndex = 0; yIndex < rows; yIndex++)
+	{
+		const size_t y0 = grid->y0 + (row + yIndex) * grid->dy;
+
+		for (size_t xIndex = 0; xIndex < columns; xIndex++)
+		{
+			const size_t   x0       = grid->x0 + xIndex * grid->dx;
+			const RGBQUAD  color    = pixels[yIndex * width + xIndex];
+			const uint32_t iterNum  = iterNums  ? iterNums[yIndex * width + xIndex]  : 0;
+			const uint16_t fraction = fractions ? fractions[yIndex * width + xIndex] : 0;
+			const float    distance = distances ? distances[yIndex * width + xIndex] : 0;
+
+			for (size_t y = y0; y < y0 + blockSize && y < frame->height; y++)
+			{
+				for (size_t x = x0; x < x0 + blockSize && x < frame->width; x++)
+				{
+					frame->pixels[y * frame->stride + x] = color;
+
+					if (iterNums)
+						frame->iterNums[y * frame->stride + x] = iterNum;
+
+					if (fractions)
+						frame->fractions[y * frame->stride + x] = fraction;
+
+					if (distances)
+						frame->distances[y * frame->stride + x] = distance;
+				}
+			}
+		}
+	}
+
+	free(pixels);
+	free(iterNums);
+	free(fractions);
+	free(distances);
+
+	return true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+void ProgressiveRenderReset(MProgressiveRender* state)
+{
+	assert(state);
+
+	*state = MProgressiveRender {};
+}
+
+/**
+ * @brief      :   1/8, 1/4, 1/2  
+ *        ,     ,   
+ *         .      tileSize  ;  
+ *          interrupted,     true,  ,
+ *                  .  ,
+ *            ,   . 
+ *            .
+ *
+ *              ,    
+ *                 ,
+ *            double .
+ *
+ * @param interrupted   ,   nullptr.
+ *
+ * @return false,    ,    , 
+ *             .
+*/
+bool RenderMandelbrotProgressive(MProgressiveRender* state, MThreadPool* pool, const MFrame* frame,
+								 const MRect* map, const MRenderParams* params, const size_t tileSize,
+								 MInterruptFunc interrupted, void* context)
+{
+	assert(state);
+	assert(pool);
+	assert(frame);
+	assert(map);
+	assert(params);
+
+	const bool resume = state->valid && state->width == frame->width && state->height == frame->height &&
+						IsSameRenderParams(&state->params, params) &&
+						state->map.minX == map->minX && state->map.maxX == map->maxX &&
+						state->map.minY == map->minY && state->map.maxY == map->maxY;
+
+	if (!resume)
+	{
+		state->valid  = true;
+		state->map    = *map;
+		state->params = *params;
+		state->width  = frame->width;
+		state->height = frame->height;
+		state->step   = PROGRESSIVE_FIRST_STEP;
+		state->part   = 0;
+		state->row    = 0;
+	}
+
+	//       ,    .
+	MRenderParams passParams = *params;
+
+	if (passParams.kernel == MKERNEL_DOUBLE)
+		passParams.kernel = GetDoubleKernel(frame, map);
+
+	if (tileSize == 0)
+	{
+		state->valid = false;
+		return false;
+	}
+
+	SkipFinishedParts(state, frame);
+
+	while (state->step > 0)
+	{
+		MGrid grid = {};
+
+		GetPassGrid(state->step, state->part, &grid);
+
+		const size_t gridRows = GetGridRows(frame, &grid);
+		const size_t rows = gridRows - state->row < tileSize ? gridRows - state->row : tileSize;
+
+		if (!RenderGridBand(pool, frame, map, &passParams, &grid, state->row, rows, state->step, tileSize))
+		{
+			state->valid = false;
+			return false;
+		}
+
+		state->row += rows;
+
+		SkipFinishedParts(state, frame);
+
+		if (interrupted && interrupted(context))
+			return true;
+	}
+
+	return true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef PROGRESSIVE_RENDER_H_
+#define PROGRESSIVE_RENDER_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//    :     1/8 .
+const size_t PROGRESSIVE_FIRST_STEP = 8;
+
+//  true,     (,  ).
+typedef bool (*MInterruptFunc)(void* context);
+
+struct MProgressiveRender
+{
+	//    ,   .
+	bool          valid;
+	MRect         map;
+	MRenderParams params;
+	size_t        width;
+	size_t        height;
+
+	//     (8, 4, 2, 1); 0 -  .
+	size_t        step;
+
+	//        .
+	size_t        part;
+	size_t        row;
+};
+
+void ProgressiveRenderReset(MProgressiveRender* state);
+
+bool RenderMandelbrotProgressive(MProgressiveRender* state, MThreadPool* pool, const MFrame* frame,
+								 const MRect* map, const MRenderParams* params, const size_t tileSize,
+								 MInterruptFunc interrupted, void* context);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "SeriesApproximation.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//   : 4   .
+const size_t SERIES_PROBES = 5;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static bool SeriesReserve(MSeries* series, size_t* capacity, const size_t length);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief    ,       length .
+*/
+static bool SeriesReserve(MSeries* series, size_t* capacity, const size_t length)
+{
+	assert(series);
+	assert(capacity);
+
+	if (length <= *capacity)
+		return true;
+
+	size_t newCapacity = *capacity ? *capacity * 2 : 1024;
+
+	while (newCapacity < length)
+		newCapacity *= 2;
+
+	double* coefX = (double*)realloc(series->coefX, newCapacity * SERIES_TERMS * sizeof(double));
+
+	if (coefX)
+		series->coefX = coefX;
+
+	double* coefY = (double*)realloc(series->coefY, newCapacity * SERIES_TERMS * sizeof(double));
+
+	if (coefY)
+		series->coefY = coefY;
+
+	if (!coefX || !coefY)
+		return false;
+
+	*capacity = newCapacity;
+
+	return true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief      ,   :
+ *
+ *            dz(n) = A1(n) dc + A2(n) dc^2 + ... + AK(n) dc^K.
+ *
+ *         dz(n + 1) = 2 Z(n) dz(n) + dz(n)^2 + dc 
+ *
+ *            Ak(n + 1) = 2 Z(n) Ak(n) +  Ai(n) A(k - i)(n)  i = 1 .. k - 1  (+ 1  k = 1).
+ *
+ *            scale^k:    1e-100 A2 
+ *           double.  ,      
+ *            -        .
+ *
+ * @return false,    .
+*/
+bool SeriesCreate(MSeries* series, const MReferenceOrbit* orbit, const MDeepView* view)
+{
+	assert(series);
+	assert(orbit);
+	assert(orbit->length > 1);
+	assert(view);
+
+	*series = MSeries {};
+
+	series->scale = hypot(view->width, view->height) / 2;
+
+	size_t capacity = 0;
+
+	if (!SeriesReserve(series, &capacity, 1))
+	{
+		SeriesDestroy(series);
+		return false;
+	}
+
+	for (size_t st = 0; st < SERIES_TERMS; st++)
+	{
+		series->coefX[st] = 0;
+		series->coefY[st] = 0;
+	}
+
+	series->length = 1;
+
+	//        :     
+	//   .
+	while (series->length + 1 < orbit->length)
+	{
+		const size_t n = series->length - 1;
+
+		if (!SeriesReserve(series, &capacity, series->length + 1))
+		{
+			SeriesDestroy(series);
+			return false;
+		}
+
+		const double* ax = series->coefX + n * SERIES_TERMS;
+		const double* ay = series->coefY + n * SERIES_TERMS;
+
+		double* nextX = series->coefX + (n + 1) * SERIES_TERMS;
+		double* nextY = series->coefY + (n + 1) * SERIES_TERMS;
+
+		const double twoZX = 2 * orbit->x[n];
+		const double twoZY = 2 * orbit->y[n];
+
+		for (size_t k = 0; k < SERIES_TERMS; k++)
+		{
+			double x = twoZX * ax[k] - twoZY * ay[k];
+			double y = twoZX * ay[k] + twoZY * ax[k];
+
+			//    i + 1  k - i    k + 1.
+			for (size_t i = 0; i < k; i++)
+			{
+				x += ax[i] * ax[k - 1 - i] - ay[i] * ay[k - 1 - i];
+				y += ax[i] * ay[k - 1 - i] + ay[i] * ax[k - 1 - i];
+			}
+
+			if (k == 0)
+				x += series->scale;
+
+			nextX[k] = x;
+			nextY[k] = y;
+		}
+
+		const double first = hypot(nextX[0], nextY[0]);
+		const double last  = hypot(nextX[SERIES_TERMS - 1], nextY[SERIES_TERMS - 1]);
+
+		if (!isfinite(first) || !isfinite(last) || last > first)
+			break;
+
+		series->length++;
+	}
+
+	return true;
+}
+
+void SeriesDestroy(MSeries* series)
+{
+	assert(series);
+
+	free(series->coefX);
+	free(series->coefY);
+
+	*series = MSeries {};
+}
+
+/**
+ * @brief   -  dz(index)  C + dc ( ).
+*/
+void SeriesEvaluate(const MSeries* series, const size_t index, const double dcX, const double dcY,
+					double* dzX, double* dzY)
+{
+	assert(series);
+	assert(index < series->length);
+	assert(dzX);
+	assert(dzY);
+
+	const double* ax = series->coefX + index * SERIES_TERMS;
+	const double* ay = series->coefY + index * SERIES_TERMS;
+
+	const double uX = dcX / series->scale;
+	const double uY = dcY / series->scale;
+
+	double x = ax[SERIES_TERMS - 1];
+	double y = ay[SERIES_TERMS - 1];
+
+	for (size_t k = SERIES_TERMS - 1; k > 0; k--)
+	{
+		double prodX = x * uX - y * uY + ax[k - 1];
+		double prodY = x * uY + y * uX + ay[k - 1];
+
+		x = prodX;
+		y = prodY;
+	}
+
+	*dzX = x * uX - y * uY;
+	*dzY = x * uY + y * uX;
+}
+
+/**
+ * @brief ,      .   (   )
+ *          ,    ,    .  n
+ *        ,    m <= n:
+ *          -  ,   |A1(m)|,  SERIES_TOLERANCE  -  dz,
+ *               c,    ;
+ *          -             ;
+ *          -  |Z(m)| + |A1(m)| |dc| + ... + |AK(m)| |dc|^K     
+ *            ,            .
+ *
+ * @return  ,   ; 1 -    (dz(1) = dc).
+*/
+size_t SeriesGetSkip(const MSeries* series, const MReferenceOrbit* orbit, const MDeepView* view,
+					 const MFrame* frame, const MRenderParams* params, const MTile* tile)
+{
+	assert(series);
+	assert(orbit);
+	assert(view);
+	assert(frame);
+	assert(params);
+	assert(tile);
+	assert(tile->width > 0 && tile->height > 0);
+
+	const double xMapStep  = view->width  / frame->width;
+	const double yMapStep  = view->height / frame->height;
+	const double pixelSize = fmin(xMapStep, yMapStep);
+
+	const size_t probeX[SERIES_PROBES] =
+	{
+		tile->x0, tile->x0 + tile->width - 1, tile->x0, tile->x0 + tile->width - 1, tile->x0 + tile->width / 2
+	};
+
+	const size_t probeY[SERIES_PROBES] =
+	{
+		tile->y0, tile->y0, tile->y0 + tile->height - 1, tile->y0 + tile->height - 1, tile->y0 + tile->height / 2
+	};
+
+	double dcX[SERIES_PROBES] = {};
+	double dcY[SERIES_PROBES] = {};
+	double dzX[SERIES_PROBES] = {};
+	double dzY[SERIES_PROBES] = {};
+
+	double maxU = 0;
+
+	for (size_t st = 0; st < SERIES_PROBES; st++)
+	{
+		dcX[st] = -view->width  / 2 + probeX[st] * xMapStep;
+		dcY[st] =  view->height / 2 - probeY[st] * yMapStep;
+		dzX[st] = dcX[st];
+		dzY[st] = dcY[st];
+
+		maxU = fmax(maxU, hypot(dcX[st], dcY[st]) / series->scale);
+	}
+
+	const double maxR2 = params->bailout * params->bailout;
+
+	size_t skip = 1;
+
+	for (size_t n = 1; n < series->length; n++)
+	{
+		const double* ax = series->coefX + n * SERIES_TERMS;
+		const double* ay = series->coefY + n * SERIES_TERMS;
+
+		const double refX = orbit->x[n];
+		const double refY = orbit->y[n];
+
+		double bound = hypot(refX, refY);
+		double power = 1;
+
+		for (size_t k = 0; k < SERIES_TERMS; k++)
+		{
+			power *= maxU;
+			bound += hypot(ax[k], ay[k]) * power;
+		}
+
+		if (bound > params->bailout)
+			break;
+
+		const double maxError = SERIES_TOLERANCE * pixelSize * hypot(ax[0], ay[0]) / series->scale;
+
+		bool valid = true;
+
+		for (size_t st = 0; st < SERIES_PROBES && valid; st++)
+		{
+			const double zX  = refX + dzX[st];
+			const double zY  = refY + dzY[st];
+			const double r2  = zX * zX + zY * zY;
+			const double dz2 = dzX[st] * dzX[st] + dzY[st] * dzY[st];
+
+			double seriesX = 0;
+			double seriesY = 0;
+
+			SeriesEvaluate(series, n, dcX[st], dcY[st], &seriesX, &seriesY);
+
+			valid = r2 <= maxR2 && r2 >= dz2 &&
+					hypot(seriesX - dzX[st], seriesY - dzY[st]) <= maxError;
+		}
+
+		if (!valid)
+			break;
+
+		skip = n;
+
+		for (size_t st = 0; st < SERIES_PROBES; st++)
+		{
+			// (2 Z + dz) dz + dc
+			const double twoZX = 2 * refX + dzX[st];
+			const double twoZY = 2 * refY + dzY[st];
+
+			const double nextX = twoZX * dzX[st] - twoZY * dzY[st] + dcX[st];
+			const double nextY = twoZX * dzY[st] + twoZY * dzX[st] + dcY[st];
+
+			dzX[st] = nextX;
+			dzY[st] = nextY;
+		}
+	}
+
+	return skip;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
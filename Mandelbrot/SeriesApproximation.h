@@ -0,0 +1,34 @@
+#ifndef SERIES_APPROXIMATION_H_
+#define SERIES_APPROXIMATION_H_
+
+#include "Perturbation.h"
+
+//    dz(n) = A1(n) dc + A2(n) dc^2 + ... + AK(n) dc^K.
+const size_t SERIES_TERMS     = 8;
+
+//   ,    c,   .
+const double SERIES_TOLERANCE = 1e-6;
+
+struct MSeries
+{
+	//   n = 0 .. length - 1,   scale^k,   
+	//   double: coefX[n * SERIES_TERMS + k - 1] = Re(Ak(n) * scale^k).
+	double* coefX;
+	double* coefY;
+	size_t  length;
+
+	//  |dc|  .
+	double  scale;
+};
+
+bool SeriesCreate(MSeries* series, const MReferenceOrbit* orbit, const MDeepView* view);
+
+void SeriesDestroy(MSeries* series);
+
+void SeriesEvaluate(const MSeries* series, const size_t index, const double dcX, const double dcY,
+					double* dzX, double* dzY);
+
+size_t SeriesGetSkip(const MSeries* series, const MReferenceOrbit* orbit, const MDeepView* view,
+					 const MFrame* frame, const MRenderParams* params, const MTile* tile);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,335 @@
+#include <assert.h>
+#include <stdio.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+struct MTaskQueue
+{
+	std::mutex         mutex;
+	std::deque<size_t> tasks;
+};
+
+struct MThreadPool
+{
+	size_t                    threadCount;
+
+	std::vector<std::thread>  threads;
+	std::vector<MTaskQueue>   queues;
+	std::vector<MThreadStats> stats;
+
+	std::mutex                mutex;
+	std::condition_variable   startCond;
+	std::condition_variable   doneCond;
+
+	size_t                    generation;
+	size_t                    activeWorkers;
+	bool                      stop;
+
+	MTask                     task;
+	void*                     context;
+
+	double                    wallSeconds;
+
+	MThreadPool(const size_t count) :
+		threadCount(count),
+		queues(count),
+		stats(count),
+		generation(0),
+		activeWorkers(0),
+		stop(false),
+		task(nullptr),
+		context(nullptr),
+		wallSeconds(0)
+	{
+	}
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static bool PopTask(MTaskQueue* queue, const bool steal, size_t* taskIndex);
+
+static void ProcessTasks(MThreadPool* pool, const size_t threadIndex);
+
+static void WorkerMain(MThreadPool* pool, const size_t threadIndex);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief    .      ,
+ *            ,    .
+*/
+static bool PopTask(MTaskQueue* queue, const bool steal, size_t* taskIndex)
+{
+	assert(queue);
+	assert(taskIndex);
+
+	std::lock_guard<std::mutex> lock(queue->mutex);
+
+	if (queue->tasks.empty())
+		return false;
+
+	if (steal)
+	{
+		*taskIndex = queue->tasks.back();
+		queue->tasks.pop_back();
+	}
+	else
+	{
+		*taskIndex = queue->tasks.front();
+		queue->tasks.pop_front();
+	}
+
+	return true;
+}
+
+static void ProcessTasks(MThreadPool* pool, const size_t threadIndex)
+{
+	assert(pool);
+
+	MThreadStats* stats = &pool->stats[threadIndex];
+
+	while (true)
+	{
+		size_t taskIndex = 0;
+		bool   stolen    = false;
+
+		if (!PopTask(&pool->queues[threadIndex], false, &taskIndex))
+		{
+			//    -  ,    .
+			for (size_t st = 1; st < pool->threadCount && !stolen; st++)
+			{
+				size_t victim = (threadIndex + st) % pool->threadCount;
+
+				stolen = PopTask(&pool->queues[victim], true, &taskIndex);
+			}
+
+			//      ,    -  .
+			if (!stolen)
+				return;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		pool->task(pool->context, taskIndex, threadIndex);
+
+		auto finish = std::chrono::steady_clock::now();
+
+		stats->busySeconds += std::chrono::duration<double>(finish - start).count();
+		stats->tasks++;
+
+		if (stolen)
+			stats->stolen++;
+	}
+}
+
+static void WorkerMain(MThreadPool* pool, const size_t threadIndex)
+{
+	assert(pool);
+
+	size_t seenGeneration = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(pool->mutex);
+
+			pool->startCond.wait(lock, [&] { return pool->stop || pool->generation != seenGeneration; });
+
+			if (pool->stop)
+				return;
+
+			seenGeneration = pool->generation;
+		}
+
+		ProcessTasks(pool, threadIndex);
+
+		{
+			std::lock_guard<std::mutex> lock(pool->mutex);
+
+			if (--pool->activeWorkers == 0)
+				pool->doneCond.notify_one();
+		}
+	}
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief   .      (  0),
+ *          threadCount - 1  .
+ *
+ * @param threadCount  . 0 -    .
+ *
+ * @return   nullptr,          .
+*/
+MThreadPool* ThreadPoolCreate(size_t threadCount)
+{
+	if (threadCount == 0)
+		threadCount = std::thread::hardware_concurrency();
+
+	if (threadCount == 0)
+		threadCount = 1;
+
+	MThreadPool* pool = nullptr;
+
+	try
+	{
+		pool = new MThreadPool(threadCount);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return nullptr;
+	}
+
+	try
+	{
+		pool->threads.reserve(threadCount - 1);
+
+		for (size_t st = 1; st < threadCount; st++)
+			pool->threads.emplace_back(WorkerMain, pool, st);
+	}
+	catch (const std::exception&)
+	{
+		//      .
+		ThreadPoolDestroy(pool);
+		return nullptr;
+	}
+
+	return pool;
+}
+
+/**
+ * @brief    : MAX_THREADS_PER_CPU   .
+*/
+size_t ThreadPoolGetMaxThreadCount()
+{
+	const size_t cpuCount = std::thread::hardware_concurrency();
+
+	return MAX_THREADS_PER_CPU * (cpuCount ? cpuCount : 1);
+}
+
+void ThreadPoolDestroy(MThreadPool* pool)
+{
+	if (!pool)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(pool->mutex);
+		pool->stop = true;
+	}
+
+	pool->startCond.notify_all();
+
+	for (size_t st = 0; st < pool->threads.size(); st++)
+		pool->threads[st].join();
+
+	delete pool;
+}
+
+size_t ThreadPoolGetThreadCount(const MThreadPool* pool)
+{
+	assert(pool);
+
+	return pool->threadCount;
+}
+
+/**
+ * @brief   0..taskCount-1  ,    .
+ *             (   ),
+ *              .
+*/
+void ThreadPoolRun(MThreadPool* pool, MTask task, void* context, const size_t taskCount)
+{
+	assert(pool);
+	assert(task);
+
+	if (taskCount == 0)
+		return;
+
+	auto start = std::chrono::steady_clock::now();
+
+	{
+		std::lock_guard<std::mutex> lock(pool->mutex);
+
+		for (size_t st = 0; st < taskCount; st++)
+			pool->queues[st * pool->threadCount / taskCount].tasks.push_back(st);
+
+		pool->task          = task;
+		pool->context       = context;
+		pool->activeWorkers = pool->threadCount - 1;
+		pool->generation++;
+	}
+
+	pool->startCond.notify_all();
+
+	ProcessTasks(pool, 0);
+
+	{
+		std::unique_lock<std::mutex> lock(pool->mutex);
+
+		pool->doneCond.wait(lock, [&] { return pool->activeWorkers == 0; });
+	}
+
+	auto finish = std::chrono::steady_clock::now();
+
+	pool->wallSeconds += std::chrono::duration<double>(finish - start).count();
+}
+
+const MThreadStats* ThreadPoolGetStats(const MThreadPool* pool, const size_t threadIndex)
+{
+	assert(pool);
+	assert(threadIndex < pool->threadCount);
+
+	return &pool->stats[threadIndex];
+}
+
+double ThreadPoolGetWallSeconds(const MThreadPool* pool)
+{
+	assert(pool);
+
+	return pool->wallSeconds;
+}
+
+void ThreadPoolResetStats(MThreadPool* pool)
+{
+	assert(pool);
+
+	for (size_t st = 0; st < pool->threadCount; st++)
+		pool->stats[st] = MThreadStats {};
+
+	pool->wallSeconds = 0;
+}
+
+/**
+ * @brief   :   ThreadPoolRun,    .
+*/
+void ThreadPoolPrintStats(const MThreadPool* pool)
+{
+	assert(pool);
+
+	for (size_t st = 0; st < pool->threadCount; st++)
+	{
+		const MThreadStats* stats = &pool->stats[st];
+
+		printf("thread %2zu: %6zu tasks (%5zu stolen), busy %9.3lf ms, utilization %5.1lf%%\n",
+			   st, stats->tasks, stats->stolen, stats->busySeconds * 1000,
+			   pool->wallSeconds > 0 ? 100 * stats->busySeconds / pool->wallSeconds : 0.0);
+	}
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <stddef.h>
+
+struct MThreadPool;
+
+//  ,  MAX_THREADS_PER_CPU   ,    .
+const size_t MAX_THREADS_PER_CPU = 4;
+
+struct MThreadStats
+{
+	size_t tasks;
+	size_t stolen;
+
+	double busySeconds;
+};
+
+typedef void (*MTask)(void* context, const size_t taskIndex, const size_t threadIndex);
+
+size_t ThreadPoolGetMaxThreadCount();
+
+MThreadPool* ThreadPoolCreate(size_t threadCount);
+
+void ThreadPoolDestroy(MThreadPool* pool);
+
+size_t ThreadPoolGetThreadCount(const MThreadPool* pool);
+
+void ThreadPoolRun(MThreadPool* pool, MTask task, void* context, const size_t taskCount);
+
+const MThreadStats* ThreadPoolGetStats(const MThreadPool* pool, const size_t threadIndex);
+
+double ThreadPoolGetWallSeconds(const MThreadPool* pool);
+
+void ThreadPoolResetStats(MThreadPool* pool);
+
+void ThreadPoolPrintStats(const MThreadPool* pool);
+
+#endif
\ No newline at end of file
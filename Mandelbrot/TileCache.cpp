@@ -0,0 +1,516 @@
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <list>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "TileCache.h"
+
+#include "MarianiSilver.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//  (tileX, tileY)     (levelX, levelY)  ,    .
+struct MTileKey
+{
+	long long tileX;
+	long long tileY;
+
+	long long levelX;
+	long long levelY;
+
+	MKernel   kernel;
+	size_t    maxIterations;
+	double    bailout;
+	bool      interiorCheck;
+	bool      periodCheck;
+
+	bool operator==(const MTileKey& other) const
+	{
+		return tileX         == other.tileX         && tileY         == other.tileY         &&
+			   levelX        == other.levelX        && levelY        == other.levelY        &&
+			   kernel        == other.kernel        && maxIterations == other.maxIterations &&
+			   bailout       == other.bailout       && interiorCheck == other.interiorCheck &&
+			   periodCheck   == other.periodCheck;
+	}
+};
+
+struct MTileKeyHash
+{
+	size_t operator()(const MTileKey& key) const
+	{
+		unsigned long long hash = 0;
+
+		const unsigned long long values[] =
+		{
+			(unsigned long long)key.tileX,  (unsigned long long)key.tileY,
+			(unsigned long long)key.levelX, (unsigned long long)key.levelY,
+			(unsigned long long)key.maxIterations
+		};
+
+		for (size_t st = 0; st < sizeof(values) / sizeof(values[0]); st++)
+			hash = (hash ^ values[st]) * 0x9E3779B97F4A7C15ULL;
+
+		return (size_t)(hash ^ (hash >> 29));
+	}
+};
+
+struct MCachedTile
+{
+	MTileKey  key;
+
+	// TILE_CACHE_TILE_SIZE x TILE_CACHE_TILE_SIZE  ,   .
+	uint32_t* iterNums;
+
+	//      ,        .
+	bool      onDisk;
+};
+
+typedef std::list<MCachedTile> MTileList;
+
+struct MTileCache
+{
+	//   -   ,    .
+	MTileList                                                     tiles;
+	std::unordered_map<MTileKey, MTileList::iterator, MTileKeyHash> index;
+
+	size_t                                                        memoryBudget;
+	std::string                                                   spillDir;
+
+	MTileCacheStats                                               stats;
+};
+
+struct MTileCacheJob
+{
+	MCachedTile*  tiles;
+
+	MRenderParams params;
+
+	double        stepX;
+	double        stepY;
+
+	//   :  2 * TILE_CACHE_TILE_SIZE^2   .
+	double*       points;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static const size_t TILE_PIXELS = TILE_CACHE_TILE_SIZE * TILE_CACHE_TILE_SIZE;
+static const size_t TILE_BYTES  = TILE_PIXELS * sizeof(uint32_t);
+
+static long long FloorDiv(const long long value, const long long divisor);
+
+static void GetSpillPath(const MTileCache* cache, const MTileKey* key, char* path, const size_t size);
+
+static bool SpillTile(MTileCache* cache, MCachedTile* tile);
+
+static bool LoadSpilledTile(const MTileCache* cache, const MTileKey* key, uint32_t* iterNums);
+
+static void EvictTiles(MTileCache* cache);
+
+static void ComputeTileTask(void* context, const size_t taskIndex, const size_t threadIndex);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static long long FloorDiv(const long long value, const long long divisor)
+{
+	assert(divisor > 0);
+
+	return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+/**
+ * @brief      .     ,   
+ *                .
+*/
+static void GetSpillPath(const MTileCache* cache, const MTileKey* key, char* path, const size_t size)
+{
+	assert(cache);
+	assert(key);
+	assert(path);
+
+	unsigned long long bailoutBits = 0;
+	memcpy(&bailoutBits, &key->bailout, sizeof(bailoutBits));
+
+	snprintf(path, size, "%s/%llx_%llx_%llx_%llx_%d_%zx_%llx_%d%d.tile", cache->spillDir.c_str(),
+			 (unsigned long long)key->tileX,  (unsigned long long)key->tileY,
+			 (unsigned long long)key->levelX, (unsigned long long)key->levelY,
+			 (int)key->kernel, key->maxIterations, bailoutBits, (int)key->interiorCheck, (int)key->periodCheck);
+}
+
+/**
+ * @brief     : ,   .
+*/
+static bool SpillTile(MTileCache* cache, MCachedTile* tile)
+{
+	assert(cache);
+	assert(tile);
+
+	char path[1024] = "";
+	GetSpillPath(cache, &tile->key, path, sizeof(path));
+
+	FILE* file = fopen(path, "wb");
+
+	if (!file)
+		return false;
+
+	bool written = fwrite(&tile->key,     sizeof(tile->key), 1,           file) == 1 &&
+				   fwrite(tile->iterNums, sizeof(uint32_t),  TILE_PIXELS, file) == TILE_PIXELS;
+
+	if (fclose(file) != 0)
+		written = false;
+
+	if (!written)
+	{
+		remove(path);
+		return false;
+	}
+
+	tile->onDisk = true;
+	cache->stats.spilled++;
+
+	return true;
+}
+
+static bool LoadSpilledTile(const MTileCache* cache, const MTileKey* key, uint32_t* iterNums)
+{
+	assert(cache);
+	assert(key);
+	assert(iterNums);
+
+	if (cache->spillDir.empty())
+		return false;
+
+	char path[1024] = "";
+	GetSpillPath(cache, key, path, sizeof(path));
+
+	FILE* file = fopen(path, "rb");
+
+	if (!file)
+		return false;
+
+	MTileKey fileKey = {};
+
+	const bool read = fread(&fileKey, sizeof(fileKey),  1,           file) == 1 && fileKey == *key &&
+					  fread(iterNums, sizeof(uint32_t), TILE_PIXELS, file) == TILE_PIXELS;
+
+	fclose(file);
+
+	return read;
+}
+
+/**
+ * @brief     ,       .
+ *           ,     .
+*/
+static void EvictTiles(MTileCache* cache)
+{
+	assert(cache);
+
+	while (!cache->tiles.empty() && cache->tiles.size() * TILE_BYTES > cache->memoryBudget)
+	{
+		MCachedTile* tile = &cache->tiles.back();
+
+		if (!cache->spillDir.empty() && !tile->onDisk)
+			SpillTile(cache, tile);
+
+		cache->index.erase(tile->key);
+		free(tile->iterNums);
+		cache->tiles.pop_back();
+
+		cache->stats.evicted++;
+	}
+}
+
+static void ComputeTileTask(void* context, const size_t taskIndex, const size_t threadIndex)
+{
+	assert(context);
+
+	const MTileCacheJob* job  = (const MTileCacheJob*)context;
+	const MCachedTile*   tile = &job->tiles[taskIndex];
+
+	double* pointsX = job->points + 2 * TILE_PIXELS * threadIndex;
+	double* pointsY = pointsX + TILE_PIXELS;
+
+	const long long x0 = tile->key.tileX * (long long)TILE_CACHE_TILE_SIZE;
+	const long long y0 = tile->key.tileY * (long long)TILE_CACHE_TILE_SIZE;
+
+	for (size_t yIndex = 0; yIndex < TILE_CACHE_TILE_SIZE; yIndex++)
+	{
+		for (size_t xIndex = 0; xIndex < TILE_CACHE_TILE_SIZE; xIndex++)
+		{
+			pointsX[yIndex * TILE_CACHE_TILE_SIZE + xIndex] =  (double)(x0 + (long long)xIndex) * job->stepX;
+			pointsY[yIndex * TILE_CACHE_TILE_SIZE + xIndex] = -(double)(y0 + (long long)yIndex) * job->stepY;
+		}
+	}
+
+	if (job->params.kernel == MKERNEL_AVX2)
+		CalcPointsAVX2(pointsX, pointsY, TILE_PIXELS, &job->params, tile->iterNums);
+	else
+		CalcPointsSSE(pointsX, pointsY, TILE_PIXELS, &job->params, tile->iterNums);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief      .
+ *
+ * @param memoryBudget       .
+ * @param spillDir      ,      
+ *                        ; nullptr -    .
+ *
+ * @return nullptr,    .
+*/
+MTileCache* TileCacheCreate(const size_t memoryBudget, const char* spillDir)
+{
+	MTileCache* cache = new (std::nothrow) MTileCache {};
+
+	if (!cache)
+		return nullptr;
+
+	cache->memoryBudget = memoryBudget;
+
+	if (spillDir)
+		cache->spillDir = spillDir;
+
+	return cache;
+}
+
+/**
+ * @brief  .    ,     ,
+ *                 .
+*/
+void TileCacheDestroy(MTileCache* cache)
+{
+	if (!cache)
+		return;
+
+	for (MTileList::iterator tile = cache->tiles.begin(); tile != cache->tiles.end(); ++tile)
+	{
+		if (!cache->spillDir.empty() && !tile->onDisk)
+			SpillTile(cache, &*tile);
+
+		free(tile->iterNums);
+	}
+
+	delete cache;
+}
+
+const MTileCacheStats* TileCacheGetStats(const MTileCache* cache)
+{
+	assert(cache);
+
+	return &cache->stats;
+}
+
+void TileCachePrintStats(const MTileCache* cache)
+{
+	assert(cache);
+
+	const MTileCacheStats* stats = &cache->stats;
+
+	printf("Tile cache: %zu hits, %zu read from disk, %zu computed, %zu evicted, %zu spilled, "
+		   "%zu tiles (%.1lf MB) in memory\n",
+		   stats->hits, stats->diskHits, stats->misses, stats->evicted, stats->spilled,
+		   cache->tiles.size(), (double)(cache->tiles.size() * TILE_BYTES) / (1024 * 1024));
+}
+
+/**
+ * @brief        .    ,
+ *             :  (I, J)  -  
+ *        (I * stepX, -J * stepY).      
+ *        (TILE_CACHE_SCALE_STEPS   ),    -   ,
+ *                  
+ *         .        ( 
+ *         )   ,      
+ *         .   ,   ,    
+ *         .
+ *
+ *             ,     .
+ *
+ *                
+ *        (CalcPointsSSE/AVX2, . GetSubdivisionKernel).
+ *
+ * @return false,   ,     
+ *         (     2^52)    .
+*/
+bool RenderMandelbrotCached(MTileCache* cache, MThreadPool* pool, const MFrame* frame, const MRect* map,
+							const MRenderParams* params)
+{
+	assert(cache);
+	assert(pool);
+	assert(frame);
+	assert(frame->pixels);
+	assert(map);
+	assert(params);
+
+	//   CalcPointsSSE/AVX2,     .
+	if (!IsRenderParamsValid(params) || params->fractal != MFRACTAL_MANDELBROT)
+		return false;
+
+	MRenderParams tileParams = *params;
+
+	tileParams.kernel = GetSubdivisionKernel(params->kernel);
+
+	const double xMapStep = (map->maxX - map->minX) / frame->width;
+	const double yMapStep = (map->maxY - map->minY) / frame->height;
+
+	if (!(xMapStep > 0 && yMapStep > 0))
+		return false;
+
+	const long long levelX = llround(log2(xMapStep) * (double)TILE_CACHE_SCALE_STEPS);
+	const long long levelY = llround(log2(yMapStep) * (double)TILE_CACHE_SCALE_STEPS);
+
+	const double stepX = exp2((double)levelX / (double)TILE_CACHE_SCALE_STEPS);
+	const double stepY = exp2((double)levelY / (double)TILE_CACHE_SCALE_STEPS);
+
+	const double maxPixelIndex = 4503599627370496.0; // 2^52
+
+	if (!(fabs(map->minX / stepX) + frame->width  < maxPixelIndex &&
+		  fabs(map->maxY / stepY) + frame->height < maxPixelIndex))
+		return false;
+
+	const long long originX = llround( map->minX / stepX);
+	const long long originY = llround(-map->maxY / stepY);
+
+	const long long tileSize = (long long)TILE_CACHE_TILE_SIZE;
+
+	const long long firstTileX = FloorDiv(originX, tileSize);
+	const long long firstTileY = FloorDiv(originY, tileSize);
+
+	const size_t tilesX = (size_t)(FloorDiv(originX + (long long)frame->width  - 1, tileSize) - firstTileX + 1);
+	const size_t tilesY = (size_t)(FloorDiv(originY + (long long)frame->height - 1, tileSize) - firstTileY + 1);
+
+	//      ,     ,   .
+	std::vector<const uint32_t*> frameTiles(tilesX * tilesY);
+	std::vector<MCachedTile>     missing;
+	std::vector<size_t>          missingSlots;
+
+	bool allocated = true;
+
+	for (size_t st = 0; st < tilesX * tilesY; st++)
+	{
+		MTileKey key = {};
+
+		key.tileX         = firstTileX + (long long)(st % tilesX);
+		key.tileY         = firstTileY + (long long)(st / tilesX);
+		key.levelX        = levelX;
+		key.levelY        = levelY;
+		key.kernel        = tileParams.kernel;
+		key.maxIterations = tileParams.maxIterations;
+		key.bailout       = tileParams.bailout;
+		key.interiorCheck = tileParams.interiorCheck;
+		key.periodCheck   = tileParams.periodCheck;
+
+		auto found = cache->index.find(key);
+
+		if (found != cache->index.end())
+		{
+			cache->tiles.splice(cache->tiles.begin(), cache->tiles, found->second);
+			frameTiles[st] = found->second->iterNums;
+			cache->stats.hits++;
+			continue;
+		}
+
+		MCachedTile tile = { key, (uint32_t*)malloc(TILE_BYTES), false };
+
+		if (!tile.iterNums)
+		{
+			allocated = false;
+			break;
+		}
+
+		if (LoadSpilledTile(cache, &key, tile.iterNums))
+		{
+			tile.onDisk = true;
+
+			cache->tiles.push_front(tile);
+			cache->index[key] = cache->tiles.begin();
+
+			frameTiles[st] = tile.iterNums;
+			cache->stats.diskHits++;
+			continue;
+		}
+
+		missing.push_back(tile);
+		missingSlots.push_back(st);
+	}
+
+	if (!allocated)
+	{
+		for (size_t st = 0; st < missing.size(); st++)
+			free(missing[st].iterNums);
+
+		EvictTiles(cache);
+		return false;
+	}
+
+	if (!missing.empty())
+	{
+		std::vector<double> points(2 * TILE_PIXELS * ThreadPoolGetThreadCount(pool));
+
+		MTileCacheJob job =
+		{
+			missing.data(),
+			tileParams,
+			stepX,
+			stepY,
+			points.data()
+		};
+
+		ThreadPoolRun(pool, ComputeTileTask, &job, missing.size());
+
+		for (size_t st = 0; st < missing.size(); st++)
+		{
+			cache->tiles.push_front(missing[st]);
+			cache->index[missing[st].key] = cache->tiles.begin();
+
+			frameTiles[missingSlots[st]] = missing[st].iterNums;
+		}
+
+		cache->stats.misses += missing.size();
+	}
+
+	for (size_t st = 0; st < tilesX * tilesY; st++)
+	{
+		const long long tileX0 = (firstTileX + (long long)(st % tilesX)) * tileSize - originX;
+		const long long tileY0 = (firstTileY + (long long)(st / tilesX)) * tileSize - originY;
+
+		const long long xBegin = tileX0 > 0 ? tileX0 : 0;
+		const long long yBegin = tileY0 > 0 ? tileY0 : 0;
+		const long long xEnd   = tileX0 + tileSize < (long long)frame->width  ? tileX0 + tileSize : (long long)frame->width;
+		const long long yEnd   = tileY0 + tileSize < (long long)frame->height ? tileY0 + tileSize : (long long)frame->height;
+
+		for (long long y = yBegin; y < yEnd; y++)
+		{
+			const uint32_t* iterNums = frameTiles[st] + (y - tileY0) * tileSize + (xBegin - tileX0);
+			const size_t    start    = (size_t)(y * (long long)frame->stride + xBegin);
+
+			if (frame->iterNums)
+				memcpy(frame->iterNums + start, iterNums, (size_t)(xEnd - xBegin) * sizeof(uint32_t));
+
+			//      .
+			if (frame->fractions)
+				memset(frame->fractions + start, 0, (size_t)(xEnd - xBegin) * sizeof(uint16_t));
+
+			ColorizeIterations(iterNums, nullptr, frame->pixels + start, (size_t)(xEnd - xBegin));
+		}
+	}
+
+	//    ,    ,    .
+	EvictTiles(cache);
+
+	return true;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef TILE_CACHE_H_
+#define TILE_CACHE_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//     .
+const size_t TILE_CACHE_TILE_SIZE = 64;
+
+//        .
+const long long TILE_CACHE_SCALE_STEPS = 1LL << 20;
+
+const size_t DEFAULT_TILE_CACHE_BUDGET = 64 * 1024 * 1024;
+
+struct MTileCache;
+
+struct MTileCacheStats
+{
+	size_t hits;
+	size_t diskHits;
+	size_t misses;
+
+	size_t evicted;
+	size_t spilled;
+};
+
+MTileCache* TileCacheCreate(const size_t memoryBudget, const char* spillDir);
+
+void TileCacheDestroy(MTileCache* cache);
+
+const MTileCacheStats* TileCacheGetStats(const MTileCache* cache);
+
+void TileCachePrintStats(const MTileCache* cache);
+
+bool RenderMandelbrotCached(MTileCache* cache, MThreadPool* pool, const MFrame* frame, const MRect* map,
+							const MRenderParams* params);
+
+#endif
\ No newline at end of file
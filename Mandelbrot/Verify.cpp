@@ -0,0 +1,588 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "Verify.h"
+
+#include "KernelStats.h"
+#include "ParallelRender.h"
+#include "Perturbation.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//     ,         .
+struct MVerifyView
+{
+	const char* name;
+
+	const char* centerX;
+	const char* centerY;
+	double      width;
+
+	size_t      maxIterations;
+
+	//      double :     .
+	// ,       0,    .
+	uint32_t    maxDifference;
+
+	//   float  : float    .
+	bool        singlePrecision;
+
+	// ,     ,    ,   
+	// :    ,        .
+	bool        chaoticInterior;
+
+	MFractal    fractal;
+	unsigned    power;
+};
+
+//  -  simple:        CalcPoint,
+//    -  RenderFormulaTile  MScalarOps.
+static const MVerifyView VERIFY_VIEWS[] =
+{
+	{ "full",      "-0.5",  "0",         3,    DEFAULT_MAX_ITERATIONS, 16,   true,  false, MFRACTAL_MANDELBROT,   0 },
+	{ "seahorse",  "-0.75", "0.0833333", 0.1,  1000,                   800,  true,  false, MFRACTAL_MANDELBROT,   0 },
+
+	//    1e-9: float      .
+	{ "spiral",    "-0.743643887037158704752191506114774", "0.131825904205311970493132056385139", 4e-7, 3000, 2250,
+				   false, false, MFRACTAL_MANDELBROT, 0 },
+
+	{ "julia",     "0",     "0",         3.2,  DEFAULT_MAX_ITERATIONS, 16,   true,  false, MFRACTAL_JULIA,        0 },
+
+	//    : FMA     180   255.
+	{ "ship",      "-0.45", "-0.7",      3.5,  DEFAULT_MAX_ITERATIONS, 230,  true,  true,  MFRACTAL_BURNING_SHIP, 0 },
+	{ "multibrot", "0",     "0",         3,    DEFAULT_MAX_ITERATIONS, 16,   true,  false, MFRACTAL_MULTIBROT,    3 }
+};
+
+//    3:     ,     
+//   .
+static const MVerifyView VERIFY_PERIOD_VIEW =
+	{ "bulb", "-0.1225", "0.7449", 0.02, 1000, 0, true, false, MFRACTAL_MANDELBROT, 0 };
+
+static const MKernel VERIFY_KERNELS[] =
+{
+	MKERNEL_SSE,
+	MKERNEL_FLOAT_SSE,
+	MKERNEL_FLOAT_SSE_REFILL,
+	MKERNEL_AVX2,
+	MKERNEL_AVX512,
+	MKERNEL_DD_SSE,
+	MKERNEL_DD_AVX2,
+	MKERNEL_DE_SSE,
+	MKERNEL_DE_AVX2
+};
+
+struct MVerifyResult
+{
+	// ,       ,    ,     .
+	size_t   mismatched;
+	size_t   beyondTolerance;
+
+	//      :   (  , . IsBoundaryPixel)
+	//     - ,     .
+	size_t   beyondInside;
+	size_t   beyondTail;
+
+	uint32_t maxDifference;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static bool IsFloatKernel(const MKernel kernel);
+
+static bool IsFormulaOpsKernel(const MKernel kernel);
+
+static void GetVerifyMap(const MVerifyView* view, MRect* map);
+
+static void GetVerifyParams(const MVerifyView* view, const MKernel kernel, const bool checks, MRenderParams* params);
+
+static bool RenderVerifyFrame(MThreadPool* pool, const MFrame* frame, const MVerifyView* view,
+							  const MRenderParams* params, const bool perturbation);
+
+static bool IsBoundaryPixel(const uint32_t* reference, const MFrame* frame, const MVerifyView* view,
+							const size_t x, const size_t y);
+
+static void CompareIterations(const uint32_t* reference, const MFrame* frame, const MVerifyView* view,
+							  const size_t tolerance, const size_t kernelWidth, MVerifyResult* result);
+
+static bool IsVerifyPassed(const MVerifyResult* result, const MFrame* frame, const MVerifyView* view,
+						   const MKernel kernel);
+
+static bool RunVerifyCase(MThreadPool* pool, const MFrame* frame, const uint32_t* reference,
+						  const MVerifyView* view, const MRenderParams* params, const bool perturbation,
+						  const size_t tolerance);
+
+static bool VerifyPeriodCheck(MThreadPool* pool, const MFrame* frame, uint32_t* reference, const size_t tolerance);
+
+static bool VerifyEscapingReference(MThreadPool* pool, const MFrame* frame);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static bool IsFloatKernel(const MKernel kernel)
+{
+	return kernel == MKERNEL_FLOAT_SSE || kernel == MKERNEL_FLOAT_SSE_REFILL;
+}
+
+/**
+ * @brief       Ops   .   
+ *          ,   sse, avx2  ,      .
+*/
+static bool IsFormulaOpsKernel(const MKernel kernel)
+{
+	return kernel == MKERNEL_SSE || kernel == MKERNEL_FLOAT_SSE || kernel == MKERNEL_AVX2 || kernel == MKERNEL_AVX512;
+}
+
+static void GetVerifyMap(const MVerifyView* view, MRect* map)
+{
+	assert(view);
+	assert(map);
+
+	const double centerX = atof(view->centerX);
+	const double centerY = atof(view->centerY);
+	const double height  = view->width * VERIFY_HEIGHT / VERIFY_WIDTH;
+
+	*map = MRect { centerX - view->width / 2, centerX + view->width / 2, centerY - height / 2, centerY + height / 2 };
+}
+
+/**
+ * @brief     kernel: checks       .
+*/
+static void GetVerifyParams(const MVerifyView* view, const MKernel kernel, const bool checks, MRenderParams* params)
+{
+	assert(view);
+	assert(params);
+
+	*params = MRenderParams {};
+
+	params->kernel              = kernel;
+	params->maxIterations       = view->maxIterations;
+	params->bailout             = DEFAULT_BAILOUT;
+	params->interiorCheck       = checks;
+	params->periodCheck         = checks;
+	params->seriesApproximation = true; //   -   ,  
+	params->fractal             = view->fractal;
+	params->juliaX              = DEFAULT_JULIA_X;
+	params->juliaY              = DEFAULT_JULIA_Y;
+	params->power               = view->power;
+}
+
+static bool RenderVerifyFrame(MThreadPool* pool, const MFrame* frame, const MVerifyView* view,
+							  const MRenderParams* params, const bool perturbation)
+{
+	assert(frame);
+	assert(view);
+	assert(params);
+
+	if (perturbation)
+	{
+		const MDeepView deep = { view->centerX, view->centerY, view->width,
+								 view->width * frame->height / frame->width };
+
+		return RenderDeepMandelbrotParallel(pool, frame, &deep, params, DEFAULT_TILE_SIZE);
+	}
+
+	MRect map = {};
+	GetVerifyMap(view, &map);
+
+	return RenderMandelbrotParallel(pool, frame, &map, params, DEFAULT_TILE_SIZE);
+}
+
+/**
+ * @brief      :      8     
+ *        .            .
+*/
+static bool IsBoundaryPixel(const uint32_t* reference, const MFrame* frame, const MVerifyView* view,
+							const size_t x, const size_t y)
+{
+	assert(reference);
+	assert(frame);
+	assert(view);
+
+	const uint32_t iterNum = reference[y * frame->stride + x];
+
+	if (view->chaoticInterior && iterNum == view->maxIterations)
+		return true;
+
+	for (size_t ny = y > 0 ? y - 1 : 0; ny <= y + 1 && ny < frame->height; ny++)
+	{
+		for (size_t nx = x > 0 ? x - 1 : 0; nx <= x + 1 && nx < frame->width; nx++)
+		{
+			if (reference[ny * frame->stride + nx] != iterNum)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @param kernelWidth   :  frame->width % kernelWidth 
+ *                       ,    .
+*/
+static void CompareIterations(const uint32_t* reference, const MFrame* frame, const MVerifyView* view,
+							  const size_t tolerance, const size_t kernelWidth, MVerifyResult* result)
+{
+	assert(reference);
+	assert(frame);
+	assert(view);
+	assert(kernelWidth > 0);
+	assert(result);
+
+	*result = MVerifyResult {};
+
+	const size_t tailStart = frame->width - frame->width % kernelWidth;
+
+	for (size_t st = 0; st < frame->stride * frame->height; st++)
+	{
+		const uint32_t expected = reference[st];
+		const uint32_t actual   = frame->iterNums[st];
+
+		const size_t   x        = st % frame->stride;
+		const size_t   y        = st / frame->stride;
+
+		if (x >= frame->width || expected == actual)
+			continue;
+
+		const uint32_t difference = expected > actual ? expected - actual : actual - expected;
+
+		result->mismatched++;
+
+		if (difference > tolerance)
+		{
+			result->beyondTolerance++;
+
+			if (x >= tailStart)
+				result->beyondTail++;
+
+			if (!IsBoundaryPixel(reference, frame, view, x, y))
+				result->beyondInside++;
+		}
+
+		if (difference > result->maxDifference)
+			result->maxDifference = difference;
+	}
+}
+
+/**
+ * @brief  ,         ,   
+ *         ,      VERIFY_DOUBLE_BUDGET (VERIFY_FLOAT_BUDGET  float) ,
+ *          double     view->maxDifference.
+*/
+static bool IsVerifyPassed(const MVerifyResult* result, const MFrame* frame, const MVerifyView* view,
+						   const MKernel kernel)
+{
+	assert(result);
+	assert(frame);
+	assert(view);
+
+	const bool   singlePrecision = IsFloatKernel(kernel);
+	const double budget          = singlePrecision ? VERIFY_FLOAT_BUDGET : VERIFY_DOUBLE_BUDGET;
+
+	return result->beyondInside == 0 && result->beyondTail == 0 &&
+		   result->beyondTolerance <= budget * frame->width * frame->height &&
+		   (singlePrecision || result->maxDifference <= view->maxDifference);
+}
+
+/**
+ * @brief    params->kernel,     
+ *          ,      -   ,     tolerance.
+ *
+ * @return false,         ,    .
+*/
+static bool RunVerifyCase(MThreadPool* pool, const MFrame* frame, const uint32_t* reference,
+						  const MVerifyView* view, const MRenderParams* params, const bool perturbation,
+						  const size_t tolerance)
+{
+	assert(frame);
+	assert(reference);
+	assert(view);
+	assert(params);
+
+	const char* kernelName = GetKernelName(perturbation ? GetPerturbationKernel(params->kernel) : params->kernel);
+	const char* checks     = params->interiorCheck ? "checks" : "raw";
+
+	MFrame target = *frame;
+
+	if (!IsDistanceKernel(params->kernel))
+		target.distances = nullptr;
+
+	if (!RenderVerifyFrame(pool, &target, view, params, perturbation))
+	{
+		printf("%-9s %-7s %-14s %-13s cannot be rendered\n", view->name, checks, kernelName,
+			   perturbation ? "perturbation" : "");
+		return false;
+	}
+
+	const MKernel renderKernel = perturbation ? GetPerturbationKernel(params->kernel) : params->kernel;
+
+	MVerifyResult result = {};
+	CompareIterations(reference, frame, view, tolerance, GetKernelWidth(renderKernel), &result);
+
+	const double pixels = (double)frame->width * frame->height;
+	const bool   passed = IsVerifyPassed(&result, frame, view, params->kernel);
+
+	printf("%-9s %-7s %-14s %-13s %9.3lf%% %9.3lf%% %7zu %5zu %9u  %s\n", view->name, checks, kernelName,
+		   perturbation ? "perturbation" : "", 100 * result.mismatched / pixels,
+		   100 * result.beyondTolerance / pixels, result.beyondInside, result.beyondTail, result.maxDifference,
+		   passed ? "ok" : "FAILED");
+
+	size_t reported = passed ? VERIFY_REPORTED_PIXELS : 0;
+
+	for (size_t st = 0; st < frame->stride * frame->height && reported < VERIFY_REPORTED_PIXELS; st++)
+	{
+		const uint32_t expected = reference[st];
+		const uint32_t actual   = frame->iterNums[st];
+
+		if (st % frame->stride >= frame->width ||
+			(expected > actual ? expected - actual : actual - expected) <= tolerance)
+			continue;
+
+		const size_t x = st % frame->stride;
+		const size_t y = st / frame->stride;
+
+		printf("    pixel (%zu, %zu): %u iteration(s), reference %u%s\n", x, y, actual, expected,
+			   IsBoundaryPixel(reference, frame, view, x, y) ? "" : " (inside a band)");
+		reported++;
+	}
+
+	return passed;
+}
+
+/**
+ * @brief  VERIFY_PERIOD_VIEW          ,
+ *             ,   RunVerifyCase,     
+ *           VERIFY_PERIOD_TRIP_RATIO      .  
+ *        KernelStats.h   ,     -  ,   .
+ *
+ * @param reference     ; .
+*/
+static bool VerifyPeriodCheck(MThreadPool* pool, const MFrame* frame, uint32_t* reference, const size_t tolerance)
+{
+	assert(frame);
+	assert(reference);
+
+	const MVerifyView* view        = &VERIFY_PERIOD_VIEW;
+	const size_t       kernelCount = sizeof(VERIFY_KERNELS) / sizeof(VERIFY_KERNELS[0]);
+
+	MFrame target = *frame;
+	target.distances = nullptr;
+
+	MRenderParams params = {};
+	GetVerifyParams(view, MKERNEL_SIMPLE, false, &params);
+
+	if (!RenderVerifyFrame(pool, &target, view, &params, false))
+	{
+		printf("%-9s %-7s %-14s %-13s cannot be rendered\n", view->name, "period", "simple", "");
+		return false;
+	}
+
+	memcpy(reference, frame->iterNums, frame->stride * frame->height * sizeof(uint32_t));
+
+	bool passed = true;
+
+	for (size_t kernel = 0; kernel < kernelCount; kernel++)
+	{
+		const MKernel verifyKernel = VERIFY_KERNELS[kernel];
+
+		if (!IsKernelSupported(verifyKernel))
+			continue;
+
+		target.distances = IsDistanceKernel(verifyKernel) ? frame->distances : nullptr;
+
+		//          ;      frame  .
+		unsigned long long trips[2]   = {};
+		double             seconds[2] = {};
+		bool               rendered   = true;
+
+		for (size_t period = 0; period < 2 && rendered; period++)
+		{
+			GetVerifyParams(view, verifyKernel, false, &params);
+			params.periodCheck = period != 0;
+
+			KernelStatsReset();
+
+			auto start = std::chrono::steady_clock::now();
+
+			rendered = RenderVerifyFrame(pool, &target, view, &params, false);
+
+			seconds[period] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			MKernelStats stats = {};
+			KernelStatsGet(&stats);
+
+			trips[period] = stats.trips;
+		}
+
+		if (!rendered)
+		{
+			printf("%-9s %-7s %-14s %-13s cannot be rendered\n", view->name, "period", GetKernelName(verifyKernel), "");
+			passed = false;
+			continue;
+		}
+
+		MVerifyResult result = {};
+		CompareIterations(reference, frame, view, tolerance, GetKernelWidth(verifyKernel), &result);
+
+		const bool matched = IsVerifyPassed(&result, frame, view, verifyKernel);
+		const bool counted = trips[0] != 0;
+		const bool fewer   = !counted || trips[1] <= VERIFY_PERIOD_TRIP_RATIO * trips[0];
+
+		if (counted)
+			printf("%-9s %-7s %-14s %-13s off %10llu trips, on %9llu trips  %s\n", view->name, "period",
+				   GetKernelName(verifyKernel), "", trips[0], trips[1],
+				   !matched ? "FAILED (iterations differ)" : fewer ? "ok" : "FAILED (cycles not found)");
+		else
+			printf("%-9s %-7s %-14s %-13s off %8.1lf ms, on %7.1lf ms (not counted)  %s\n", view->name, "period",
+				   GetKernelName(verifyKernel), "", seconds[0] * 1000, seconds[1] * 1000,
+				   matched ? "ok" : "FAILED (iterations differ)");
+
+		passed = passed && matched && fewer;
+	}
+
+	return passed;
+}
+
+/**
+ * @brief ,        ,  
+ *             Z(1),        .
+*/
+static bool VerifyEscapingReference(MThreadPool* pool, const MFrame* frame)
+{
+	assert(frame);
+
+	const MDeepView view = { "9", "9", 1e-5, 1e-5 * frame->height / frame->width };
+
+	bool passed = true;
+
+	for (size_t series = 0; series < 2; series++)
+	{
+		MRenderParams params = {};
+
+		params.kernel              = MKERNEL_SSE;
+		params.maxIterations       = DEFAULT_MAX_ITERATIONS;
+		params.bailout             = DEFAULT_BAILOUT;
+		params.seriesApproximation = series != 0;
+		params.fractal             = MFRACTAL_MANDELBROT;
+
+		const bool rejected = !RenderDeepMandelbrotParallel(pool, frame, &view, &params, DEFAULT_TILE_SIZE);
+
+		printf("%-9s %-7s %-14s %-13s %-31s %s\n", "escaping", series ? "series" : "raw", "sse", "perturbation",
+			   rejected ? "rejected" : "rendered", rejected ? "ok" : "FAILED");
+
+		passed = passed && rejected;
+	}
+
+	return passed;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief     ,   ,   -
+ *         simple -   VERIFY_VIEWS,      
+ *          .         (sse  avx2).  ,
+ *                  tolerance;   ,
+ *        . IsVerifyPassed.  ,       
+ *        (VerifyPeriodCheck).
+ *
+ * @return false,  -        .
+*/
+bool RunKernelVerification(MThreadPool* pool, const size_t tolerance)
+{
+	assert(pool);
+
+	MFrame frame = {};
+
+	//       ,   .
+	const bool   allocated  = FrameCreate(&frame, VERIFY_WIDTH, VERIFY_HEIGHT, true, true, true);
+	const size_t pixelCount = frame.stride * frame.height;
+
+	uint32_t* reference = (uint32_t*)malloc(pixelCount * sizeof(uint32_t));
+
+	if (!allocated || !reference)
+	{
+		puts("Not enough memory for the verification.");
+		FrameDestroy(&frame);
+		free(reference);
+		return false;
+	}
+
+	const size_t viewCount   = sizeof(VERIFY_VIEWS)   / sizeof(VERIFY_VIEWS[0]);
+	const size_t kernelCount = sizeof(VERIFY_KERNELS) / sizeof(VERIFY_KERNELS[0]);
+
+	printf("Verification against simple: %zux%zu, tolerance %zu iteration(s)\n", VERIFY_WIDTH, VERIFY_HEIGHT,
+		   tolerance);
+	printf("%-9s %-7s %-14s %-13s %10s %10s %7s %5s %9s\n", "view", "checks", "kernel", "", "differ", "beyond",
+		   "inside", "tail", "max diff");
+
+	size_t failed = 0;
+
+	for (size_t view = 0; view < viewCount; view++)
+	{
+		const MVerifyView* verifyView = &VERIFY_VIEWS[view];
+
+		for (size_t checks = 0; checks < 2; checks++)
+		{
+			MRenderParams referenceParams = {};
+			GetVerifyParams(verifyView, MKERNEL_SIMPLE, checks != 0, &referenceParams);
+
+			if (!RenderVerifyFrame(pool, &frame, verifyView, &referenceParams, false))
+			{
+				printf("%-9s %-7s %-14s %-13s cannot be rendered\n", verifyView->name, checks ? "checks" : "raw",
+					   "simple", "");
+				failed++;
+				continue;
+			}
+
+			memcpy(reference, frame.iterNums, pixelCount * sizeof(uint32_t));
+
+			for (size_t kernel = 0; kernel < kernelCount + 2; kernel++)
+			{
+				//    -    sse  avx2.
+				const bool    perturbation = kernel >= kernelCount;
+				const MKernel verifyKernel = perturbation ? (kernel == kernelCount ? MKERNEL_SSE : MKERNEL_AVX2) :
+															VERIFY_KERNELS[kernel];
+
+				if (!IsKernelSupported(verifyKernel) || (IsFloatKernel(verifyKernel) && !verifyView->singlePrecision))
+					continue;
+
+				MRenderParams params = referenceParams;
+				params.kernel = verifyKernel;
+
+				//          .
+				if (!IsRenderParamsValid(&params) ||
+					(verifyView->fractal != MFRACTAL_MANDELBROT && (perturbation || !IsFormulaOpsKernel(verifyKernel))))
+					continue;
+
+				if (!RunVerifyCase(pool, &frame, reference, verifyView, &params, perturbation, tolerance))
+					failed++;
+			}
+		}
+	}
+
+	if (!VerifyPeriodCheck(pool, &frame, reference, tolerance))
+		failed++;
+
+	//  9 + 9i     Z(1):     .
+	if (!VerifyEscapingReference(pool, &frame))
+		failed++;
+
+	if (failed)
+		printf("%zu case(s) FAILED\n", failed);
+	else
+		puts("All kernels match the reference.");
+
+	FrameDestroy(&frame);
+	free(reference);
+
+	return failed == 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
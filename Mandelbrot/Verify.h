@@ -0,0 +1,32 @@
+#ifndef VERIFY_H_
+#define VERIFY_H_
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//   .  :       
+// ,       .
+const size_t VERIFY_WIDTH  = 387;
+const size_t VERIFY_HEIGHT = 256;
+
+//  ,     ,     .
+const size_t VERIFY_REPORTED_PIXELS = 8;
+
+//  ,         (   
+//   ).     ,    
+// (FMA, double-double,  )        :
+//    3000  -  1,2% . float   double   
+//  .       ( )    .
+const double VERIFY_DOUBLE_BUDGET = 0.02;
+const double VERIFY_FLOAT_BUDGET  = 0.05;
+
+//     3       
+//   1000,       10-20  .   --period on
+//       ,   .  
+//  KernelStats.h,       MANDELBROT_KERNEL_STATS.
+const double VERIFY_PERIOD_TRIP_RATIO = 0.5;
+
+bool RunKernelVerification(MThreadPool* pool, const size_t tolerance);
+
+#endif
\ No newline at end of file
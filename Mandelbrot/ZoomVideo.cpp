@@ -0,0 +1,705 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ZoomVideo.h"
+
+#include "ParallelRender.h"
+#include "Perturbation.h"
+#include "MarianiSilver.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+//     :   ,     ,
+//       ,    .
+struct MVideoQueue
+{
+	std::mutex              mutex;
+	std::condition_variable changed;
+
+	std::deque<size_t>      free;
+	std::deque<size_t>      ready;
+
+	//   (  ready   ) /   .
+	bool                    finished;
+	bool                    failed;
+
+	MVideoQueue() :
+		finished(false),
+		failed(false)
+	{
+	}
+};
+
+struct MVideoWriter
+{
+	MVideoQueue*        queue;
+	const MFrame*       frames;
+	const MVideoOutput* output;
+
+	//    ,   fwrite.
+	unsigned char*      data;
+	size_t              dataSize;
+
+	double              writeSeconds;
+	double              waitSeconds;
+};
+
+struct MKeyframeJob
+{
+	const MFrame*        frame;
+	const MFrame*        keyframe;
+	const MRenderParams* params;
+
+	//       (CalcPointsSSE/AVX2).
+	MKernel              kernel;
+	size_t               tolerance;
+
+	double               minX;
+	double               maxY;
+	double               xMapStep;
+	double               yMapStep;
+
+	double               keyMinX;
+	double               keyMaxY;
+	double               keyStepX;
+	double               keyStepY;
+
+	std::atomic<size_t>  exactPixels;
+
+	// -   :      .
+	std::atomic<bool>    failed;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static size_t GetVideoFrameSize(const MVideoFormat format, const size_t width, const size_t height);
+
+static unsigned char ClampByte(const int value);
+
+static void ConvertFrameY4M(const MFrame* frame, unsigned char* data);
+
+static void ConvertFrameRGB(const MFrame* frame, unsigned char* data);
+
+static void WriterMain(MVideoWriter* writer);
+
+static MRect GetZoomMap(const MZoomPath* path, const MFrame* frame, const double width);
+
+static double GetZoomWidth(const MZoomPath* path, const double zoomStep, const size_t index);
+
+static bool RenderZoomFrame(MThreadPool* pool, const MFrame* frame, const MZoomPath* path, const double width,
+							const MReferenceOrbit* orbit, const MRenderParams* params, const size_t tileSize);
+
+static void InterpolateTileFunc(void* context, const MTile* tile);
+
+static bool InterpolateZoomFrame(MThreadPool* pool, const MFrame* frame, const MZoomPath* path, const double width,
+								 const MFrame* keyframe, const double keyWidth, const MRenderParams* params,
+								 const size_t tileSize, size_t* exactPixels);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+static size_t GetVideoFrameSize(const MVideoFormat format, const size_t width, const size_t height)
+{
+	if (format == MVIDEO_Y4M)
+		return strlen("FRAME\n") + width * height + 2 * (width / 2) * (height / 2);
+
+	return width * height * 3;
+}
+
+static inline unsigned char ClampByte(const int value)
+{
+	return (unsigned char)(value < 0 ? 0 : value > 255 ? 255 : value);
+}
+
+/**
+ * @brief    YUV 4:2:0    (BT.601,   JPEG):  -  
+ *        ,  -     2x2.   1/65536.
+ *           ,       bmp  --out.
+*/
+static void ConvertFrameY4M(const MFrame* frame, unsigned char* data)
+{
+	assert(frame);
+	assert(frame->pixels);
+	assert(data);
+
+	const size_t width  = frame->width;
+	const size_t height = frame->height;
+	const size_t stride = frame->stride;
+
+	memcpy(data, "FRAME\n", strlen("FRAME\n"));
+
+	unsigned char* planeY = data + strlen("FRAME\n");
+	unsigned char* planeU = planeY + width * height;
+	unsigned char* planeV = planeU + (width / 2) * (height / 2);
+
+	for (size_t y = 0; y < height; y++)
+	{
+		const RGBQUAD* row = frame->pixels + (height - 1 - y) * stride;
+
+		for (size_t x = 0; x < width; x++)
+			planeY[y * width + x] = ClampByte((19595 * row[x].rgbRed + 38470 * row[x].rgbGreen +
+											   7471 * row[x].rgbBlue + 32768) >> 16);
+	}
+
+	for (size_t y = 0; y < height / 2; y++)
+	{
+		const RGBQUAD* top    = frame->pixels + (height - 1 - 2 * y) * stride;
+		const RGBQUAD* bottom = top - stride;
+
+		for (size_t x = 0; x < width / 2; x++)
+		{
+			const int red   = top[2 * x].rgbRed   + top[2 * x + 1].rgbRed   + bottom[2 * x].rgbRed   + bottom[2 * x + 1].rgbRed;
+			const int green = top[2 * x].rgbGreen + top[2 * x + 1].rgbGreen + bottom[2 * x].rgbGreen + bottom[2 * x + 1].rgbGreen;
+			const int blue  = top[2 * x].rgbBlue  + top[2 * x + 1].rgbBlue  + bottom[2 * x].rgbBlue  + bottom[2 * x + 1].rgbBlue;
+
+			//   :   18  16    4.
+			planeU[y * (width / 2) + x] = ClampByte((-11056 * red - 21712 * green + 32768 * blue + (128 << 18) + (1 << 17)) >> 18);
+			planeV[y * (width / 2) + x] = ClampByte(( 32768 * red - 27440 * green -  5328 * blue + (128 << 18) + (1 << 17)) >> 18);
+		}
+	}
+}
+
+static void ConvertFrameRGB(const MFrame* frame, unsigned char* data)
+{
+	assert(frame);
+	assert(frame->pixels);
+	assert(data);
+
+	for (size_t y = 0; y < frame->height; y++)
+	{
+		const RGBQUAD* row = frame->pixels + (frame->height - 1 - y) * frame->stride;
+
+		for (size_t x = 0; x < frame->width; x++, data += 3)
+		{
+			data[0] = row[x].rgbRed;
+			data[1] = row[x].rgbGreen;
+			data[2] = row[x].rgbBlue;
+		}
+	}
+}
+
+/**
+ * @brief  :     ,    
+ *           .     .
+*/
+static void WriterMain(MVideoWriter* writer)
+{
+	assert(writer);
+
+	MVideoQueue* queue = writer->queue;
+
+	while (true)
+	{
+		size_t index = 0;
+
+		{
+			auto waitStart = std::chrono::steady_clock::now();
+
+			std::unique_lock<std::mutex> lock(queue->mutex);
+
+			queue->changed.wait(lock, [queue] { return !queue->ready.empty() || queue->finished; });
+
+			writer->waitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - waitStart).count();
+
+			if (queue->ready.empty())
+				return;
+
+			index = queue->ready.front();
+			queue->ready.pop_front();
+		}
+
+		auto writeStart = std::chrono::steady_clock::now();
+
+		if (writer->output->format == MVIDEO_Y4M)
+			ConvertFrameY4M(&writer->frames[index], writer->data);
+		else
+			ConvertFrameRGB(&writer->frames[index], writer->data);
+
+		bool written = fwrite(writer->data, 1, writer->dataSize, writer->output->file) == writer->dataSize;
+
+		writer->writeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - writeStart).count();
+
+		{
+			std::lock_guard<std::mutex> lock(queue->mutex);
+
+			queue->free.push_back(index);
+			queue->failed = queue->failed || !written;
+		}
+
+		queue->changed.notify_all();
+
+		if (!written)
+			return;
+	}
+}
+
+static MRect GetZoomMap(const MZoomPath* path, const MFrame* frame, const double width)
+{
+	assert(path);
+	assert(frame);
+
+	const double height  = width * frame->height / frame->width;
+	const double centerX = atof(path->centerX);
+	const double centerY = atof(path->centerY);
+
+	return MRect { centerX - width / 2, centerX + width / 2, centerY - height / 2, centerY + height / 2 };
+}
+
+/**
+ * @brief    index: startWidth * (endWidth / startWidth)^(index / (frames - 1)),
+ *         zoomStep -     .   -  endWidth.
+*/
+static double GetZoomWidth(const MZoomPath* path, const double zoomStep, const size_t index)
+{
+	assert(path);
+
+	return index + 1 == path->frames ? path->endWidth : path->startWidth * exp(zoomStep * (double)index);
+}
+
+static bool RenderZoomFrame(MThreadPool* pool, const MFrame* frame, const MZoomPath* path, const double width,
+							const MReferenceOrbit* orbit, const MRenderParams* params, const size_t tileSize)
+{
+	assert(frame);
+	assert(path);
+	assert(params);
+
+	if (path->deep)
+	{
+		const MDeepView view = { path->centerX, path->centerY, width, width * frame->height / frame->width };
+
+		return RenderDeepMandelbrotOrbit(pool, frame, &view, orbit, params, tileSize);
+	}
+
+	const MRect map = GetZoomMap(path, frame, width);
+
+	//   double   :  MKERNEL_DOUBLE    .
+	MRenderParams frameParams = *params;
+
+	if (frameParams.kernel == MKERNEL_DOUBLE)
+		frameParams.kernel = GetDoubleKernel(frame, &map);
+
+	return RenderMandelbrotParallel(pool, frame, &map, &frameParams, tileSize);
+}
+
+/**
+ * @brief       :     4 
+ *         ,           job->tolerance,
+ *           -    (  -   ).
+ *               ,     ;
+ *                   .
+*/
+static void InterpolateTileFunc(void* context, const MTile* tile)
+{
+	assert(context);
+	assert(tile);
+
+	MKeyframeJob*  job      = (MKeyframeJob*)context;
+	const MFrame*  frame    = job->frame;
+	const MFrame*  keyframe = job->keyframe;
+
+	const size_t maxPixels = tile->width * tile->height;
+
+	size_t*   exact      = (size_t*)  malloc(maxPixels * sizeof(size_t));
+	double*   pointsX    = (double*)  malloc(maxPixels * sizeof(double));
+	double*   pointsY    = (double*)  malloc(maxPixels * sizeof(double));
+	uint32_t* iters      = (uint32_t*)malloc(maxPixels * sizeof(uint32_t));
+	size_t*   keyColumns = (size_t*)  malloc(tile->width * sizeof(size_t));
+	double*   keyWeights = (double*)  malloc(tile->width * sizeof(double));
+
+	if (!exact || !pointsX || !pointsY || !iters || !keyColumns || !keyWeights)
+	{
+		free(exact);
+		free(pointsX);
+		free(pointsY);
+		free(iters);
+		free(keyColumns);
+		free(keyWeights);
+
+		job->failed = true;
+		return;
+	}
+
+	const size_t keyWidth  = keyframe->width;
+	const size_t keyHeight = keyframe->height;
+
+	//           -     .
+	//    i   -  keyMinX + i * keyStepX.
+	for (size_t x = tile->x0; x < tile->x0 + tile->width; x++)
+	{
+		const double pointX = job->minX + (double)x * job->xMapStep;
+		const double keyX   = fmin(fmax((pointX - job->keyMinX) / job->keyStepX, 0), (double)(keyWidth - 1));
+		const size_t x0     = keyX < (double)(keyWidth - 1) ? (size_t)keyX : keyWidth - 2;
+
+		keyColumns[x - tile->x0] = x0;
+		keyWeights[x - tile->x0] = keyX - (double)x0;
+	}
+
+	size_t exactCount = 0;
+
+	for (size_t y = tile->y0; y < tile->y0 + tile->height; y++)
+	{
+		const double pointY = job->maxY - (double)y * job->yMapStep;
+
+		const double keyY = fmin(fmax((job->keyMaxY - pointY) / job->keyStepY, 0), (double)(keyHeight - 1));
+		const size_t y0   = keyY < (double)(keyHeight - 1) ? (size_t)keyY : keyHeight - 2;
+		const double fy   = keyY - (double)y0;
+
+		const uint32_t* rowTop    = keyframe->iterNums + y0 * keyframe->stride;
+		const uint32_t* rowBottom = fy > 0 ? rowTop + keyframe->stride : rowTop;
+
+		uint32_t* iterNums = frame->iterNums + y * frame->stride;
+
+		for (size_t x = tile->x0; x < tile->x0 + tile->width; x++)
+		{
+			const size_t x0 = keyColumns[x - tile->x0];
+			const double fx = keyWeights[x - tile->x0];
+			const size_t x1 = fx > 0 ? x0 + 1 : x0;
+
+			const uint32_t a = rowTop[x0];
+			const uint32_t b = rowTop[x1];
+			const uint32_t c = rowBottom[x0];
+			const uint32_t d = rowBottom[x1];
+
+			const uint32_t loTop = a < b ? a : b;
+			const uint32_t hiTop = a < b ? b : a;
+			const uint32_t lo    = c < d ? (c < loTop ? c : loTop) : (d < loTop ? d : loTop);
+			const uint32_t hi    = c < d ? (d > hiTop ? d : hiTop) : (c > hiTop ? c : hiTop);
+
+			if (hi - lo > job->tolerance)
+			{
+				exact[exactCount]   = y * frame->stride + x;
+				pointsX[exactCount] = job->minX + (double)x * job->xMapStep;
+				pointsY[exactCount] = pointY;
+				exactCount++;
+				continue;
+			}
+
+			if (hi == lo)
+			{
+				iterNums[x] = lo;
+				continue;
+			}
+
+			const double top    = a + (double)((long long)b - a) * fx;
+			const double bottom = c + (double)((long long)d - c) * fx;
+
+			iterNums[x] = (uint32_t)(top + (bottom - top) * fy + 0.5);
+		}
+	}
+
+	if (exactCount > 0)
+	{
+		if (job->kernel == MKERNEL_AVX2)
+			CalcPointsAVX2(pointsX, pointsY, exactCount, job->params, iters);
+		else
+			CalcPointsSSE(pointsX, pointsY, exactCount, job->params, iters);
+
+		for (size_t st = 0; st < exactCount; st++)
+			frame->iterNums[exact[st]] = iters[st];
+
+		job->exactPixels += exactCount;
+	}
+
+	for (size_t y = tile->y0; y < tile->y0 + tile->height; y++)
+	{
+		const size_t rowStart = y * frame->stride + tile->x0;
+
+		ColorizeIterations(frame->iterNums + rowStart, nullptr, frame->pixels + rowStart, tile->width);
+	}
+
+	free(exact);
+	free(pointsX);
+	free(pointsY);
+	free(iters);
+	free(keyColumns);
+	free(keyWeights);
+}
+
+/**
+ * @brief    width     keyWidth    
+ *        (InterpolateTileFunc).       ,  
+ *        keyWidth / keyframe->width <= width / frame->width,  keyWidth >= width.
+ *
+ * @param exactPixels    .
+ *
+ * @return false,  -    :    .
+*/
+static bool InterpolateZoomFrame(MThreadPool* pool, const MFrame* frame, const MZoomPath* path, const double width,
+								 const MFrame* keyframe, const double keyWidth, const MRenderParams* params,
+								 const size_t tileSize, size_t* exactPixels)
+{
+	assert(frame);
+	assert(frame->iterNums);
+	assert(keyframe);
+	assert(keyframe->iterNums);
+	assert(keyframe->width >= 2 && keyframe->height >= 2);
+	assert(exactPixels);
+
+	const MRect map    = GetZoomMap(path, frame, width);
+	const MRect keyMap = GetZoomMap(path, keyframe, keyWidth);
+
+	MKeyframeJob job;
+
+	job.frame       = frame;
+	job.keyframe    = keyframe;
+	job.params      = params;
+	job.kernel      = GetSubdivisionKernel(params->kernel);
+	job.tolerance   = path->keyframeTolerance;
+	job.minX        = map.minX;
+	job.maxY        = map.maxY;
+	job.xMapStep    = (map.maxX - map.minX) / frame->width;
+	job.yMapStep    = (map.maxY - map.minY) / frame->height;
+	job.keyMinX     = keyMap.minX;
+	job.keyMaxY     = keyMap.maxY;
+	job.keyStepX    = (keyMap.maxX - keyMap.minX) / keyframe->width;
+	job.keyStepY    = (keyMap.maxY - keyMap.minY) / keyframe->height;
+	job.exactPixels = 0;
+	job.failed      = false;
+
+	RenderTilesParallel(pool, frame, tileSize, InterpolateTileFunc, &job);
+
+	*exactPixels = job.exactPixels;
+
+	return !job.failed;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+
+/**
+ * @brief         .  i + 1 ,   i
+ *                (ZOOM_VIDEO_BUFFERS ),
+ *                ,    .
+ *         path->deep         : 
+ *           ,       .
+ *         path->keyframeScale     (InterpolateZoomFrame):   
+ *         keyframeScale^2   ,     ,   
+ *          keyframeScale ,         .
+ *
+ * @param width   ;  MVIDEO_Y4M    .
+ * @param stats   ;   nullptr.
+ *
+ * @return false,        (  -   
+ *           path->deep,     ),   ,
+ *            (. RenderMandelbrotParallel / RenderDeepMandelbrotOrbit)
+ *            .
+*/
+bool RenderZoomVideo(MThreadPool* pool, const MZoomPath* path, const size_t width, const size_t height,
+					 const MRenderParams* params, const size_t tileSize, const MVideoOutput* output,
+					 MZoomVideoStats* stats)
+{
+	assert(pool);
+	assert(path);
+	assert(path->centerX);
+	assert(path->centerY);
+	assert(params);
+	assert(output);
+	assert(output->file);
+
+	if (width == 0 || height == 0 || path->frames == 0 || output->fps == 0 ||
+		!(path->startWidth > 0 && path->endWidth > 0) ||
+		(output->format == MVIDEO_Y4M && (width % 2 != 0 || height % 2 != 0)))
+		return false;
+
+	//     CalcPointsSSE/AVX2:       double.
+	if (path->keyframeScale &&
+		(path->keyframeScale < MIN_KEYFRAME_SCALE || path->keyframeScale > MAX_KEYFRAME_SCALE || path->deep ||
+		 params->smoothColoring || IsDistanceKernel(params->kernel) || params->fractal != MFRACTAL_MANDELBROT))
+		return false;
+
+	MZoomVideoStats zoomStats = {};
+
+	//   -      .
+	MReferenceOrbit orbit = {};
+
+	if (path->deep)
+	{
+		auto orbitStart = std::chrono::steady_clock::now();
+
+		const double    deepestWidth = fmin(path->startWidth, path->endWidth);
+		const MDeepView deepest      = { path->centerX, path->centerY, deepestWidth, deepestWidth * height / width };
+
+		MFrame frameSize = {};
+
+		frameSize.width  = width;
+		frameSize.height = height;
+		frameSize.stride = width;
+
+		if (!ReferenceOrbitCreate(&orbit, &deepest, &frameSize, params))
+			return false;
+
+		zoomStats.orbitSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - orbitStart).count();
+	}
+
+	const bool   distance = IsDistanceKernel(params->kernel);
+
+	MVideoQueue  queue;
+	MFrame       frames[ZOOM_VIDEO_BUFFERS] = {};
+
+	MVideoWriter writer = { &queue, frames, output, nullptr, GetVideoFrameSize(output->format, width, height), 0, 0 };
+
+	//  :     .     keyframeScale 
+	//        MAX_FRAME_SIZE.
+	MFrame keyframe = {};
+
+	writer.data = (unsigned char*)malloc(writer.dataSize);
+
+	bool allocated = writer.data != nullptr;
+
+	for (size_t st = 0; st < ZOOM_VIDEO_BUFFERS && allocated; st++)
+	{
+		allocated = FrameCreate(&frames[st], width, height, true, true, distance);
+		queue.free.push_back(st);
+	}
+
+	if (allocated && path->keyframeScale)
+		allocated = FrameCreate(&keyframe, width * path->keyframeScale, height * path->keyframeScale,
+								true, false, false);
+
+	if (!allocated)
+	{
+		for (size_t st = 0; st < ZOOM_VIDEO_BUFFERS; st++)
+			FrameDestroy(&frames[st]);
+
+		free(writer.data);
+		ReferenceOrbitDestroy(&orbit);
+		return false;
+	}
+
+	char header[128] = "";
+	int  headerSize  = 0;
+
+	if (output->format == MVIDEO_Y4M)
+		headerSize = snprintf(header, sizeof(header), "YUV4MPEG2 W%zu H%zu F%zu:1 Ip A1:1 C420jpeg\n",
+							  width, height, output->fps);
+
+	bool rendered = headerSize == 0 || fwrite(header, 1, (size_t)headerSize, output->file) == (size_t)headerSize;
+
+	std::thread writerThread(WriterMain, &writer);
+
+	const double zoomStep = path->frames > 1 ? log(path->endWidth / path->startWidth) / (double)(path->frames - 1) : 0;
+
+	//      :          keyframeScale ,
+	//   ,     ,    .
+	size_t segmentLength = path->frames;
+
+	if (path->keyframeScale && fabs(zoomStep) * (double)path->frames > log((double)path->keyframeScale))
+		segmentLength = 1 + (size_t)(log((double)path->keyframeScale) / fabs(zoomStep));
+
+	double keyWidth = 0;
+	bool   keyValid = false;
+
+	for (size_t st = 0; st < path->frames && rendered; st++)
+	{
+		size_t index = 0;
+
+		{
+			auto waitStart = std::chrono::steady_clock::now();
+
+			std::unique_lock<std::mutex> lock(queue.mutex);
+
+			queue.changed.wait(lock, [&queue] { return !queue.free.empty() || queue.failed; });
+
+			zoomStats.renderWaitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - waitStart).count();
+
+			if (queue.failed)
+				break;
+
+			index = queue.free.front();
+			queue.free.pop_front();
+		}
+
+		auto renderStart = std::chrono::steady_clock::now();
+
+		const double frameWidth = GetZoomWidth(path, zoomStep, st);
+
+		if (keyframe.pixels && st % segmentLength == 0)
+		{
+			const size_t last = (st + segmentLength < path->frames ? st + segmentLength : path->frames) - 1;
+
+			keyWidth = fmax(frameWidth, GetZoomWidth(path, zoomStep, last));
+
+			const MRect keyMap = GetZoomMap(path, &keyframe, keyWidth);
+
+			// ,    double,     double-double.
+			keyValid = IsDoublePrecisionEnough(&keyframe, &keyMap);
+
+			if (keyValid)
+			{
+				auto keyStart = std::chrono::steady_clock::now();
+
+				keyValid = rendered = RenderZoomFrame(pool, &keyframe, path, keyWidth, &orbit, params, tileSize);
+
+				zoomStats.keyframes++;
+				zoomStats.keyframeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - keyStart).count();
+			}
+		}
+
+		if (keyValid)
+		{
+			size_t exactPixels = 0;
+
+			rendered = InterpolateZoomFrame(pool, &frames[index], path, frameWidth, &keyframe, keyWidth, params,
+											tileSize, &exactPixels);
+
+			zoomStats.exactPixels += exactPixels;
+		}
+		else if (rendered)
+			rendered = RenderZoomFrame(pool, &frames[index], path, frameWidth, &orbit, params, tileSize);
+
+		zoomStats.renderSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - renderStart).count();
+
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			if (rendered)
+			{
+				queue.ready.push_back(index);
+				zoomStats.frames++;
+			}
+			else
+				queue.free.push_back(index);
+		}
+
+		queue.changed.notify_all();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.finished = true;
+	}
+
+	queue.changed.notify_all();
+	writerThread.join();
+
+	rendered = rendered && !queue.failed && fflush(output->file) == 0;
+
+	zoomStats.writeSeconds     = writer.writeSeconds;
+	zoomStats.writeWaitSeconds = writer.waitSeconds;
+
+	if (stats)
+		*stats = zoomStats;
+
+	for (size_t st = 0; st < ZOOM_VIDEO_BUFFERS; st++)
+		FrameDestroy(&frames[st]);
+
+	FrameDestroy(&keyframe);
+	free(writer.data);
+	ReferenceOrbitDestroy(&orbit);
+
+	return rendered;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***\\\
\ No newline at end of file
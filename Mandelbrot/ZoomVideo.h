@@ -0,0 +1,84 @@
+#ifndef ZOOM_VIDEO_H_
+#define ZOOM_VIDEO_H_
+
+#include <stdio.h>
+
+#include "MandelbrotRender.h"
+
+#include "ThreadPool.h"
+
+//   :  ,  ,     .
+const size_t ZOOM_VIDEO_BUFFERS = 3;
+
+const size_t DEFAULT_VIDEO_FPS  = 30;
+
+//          ;    
+//    ,    .
+const size_t MIN_KEYFRAME_SCALE = 2;
+const size_t MAX_KEYFRAME_SCALE = 4;
+
+enum MVideoFormat
+{
+	// YUV4MPEG2 4:2:0 (C420jpeg,   BT.601);     .
+	MVIDEO_Y4M,
+
+	//  rgb24   .
+	MVIDEO_RGB
+};
+
+//    :     startWidth  endWidth
+//   ,            .
+//      .
+struct MZoomPath
+{
+	//  -  ;  deep == false   double.
+	const char* centerX;
+	const char* centerY;
+
+	double      startWidth;
+	double      endWidth;
+
+	size_t      frames;
+
+	//           .
+	bool        deep;
+
+	//       keyframeScale   ; 0 -  
+	//  . ,        
+	//     keyframeTolerance,  .
+	size_t      keyframeScale;
+	size_t      keyframeTolerance;
+};
+
+struct MVideoOutput
+{
+	FILE*        file;
+	MVideoFormat format;
+	size_t       fps;
+};
+
+struct MZoomVideoStats
+{
+	size_t frames;
+
+	//   (   ),  ,      .
+	double orbitSeconds;
+	double renderSeconds;
+	double writeSeconds;
+
+	//     (  )     .
+	double renderWaitSeconds;
+	double writeWaitSeconds;
+
+	//  : ,    (  renderSeconds)
+	//         .
+	size_t keyframes;
+	double keyframeSeconds;
+	size_t exactPixels;
+};
+
+bool RenderZoomVideo(MThreadPool* pool, const MZoomPath* path, const size_t width, const size_t height,
+					 const MRenderParams* params, const size_t tileSize, const MVideoOutput* output,
+					 MZoomVideoStats* stats);
+
+#endif
\ No newline at end of file
@@ -1,12 +1,20 @@
 #include <stdio.h>
 
+#include "Headless.h"
+
+#ifdef _WIN32
 #include "Mandelbrot.h"
 
 #include "AlphaBlending.h"
+#endif
 
 
 int main(int argc, char* argv[])
 {
+#ifdef _WIN32
+	if (argc > 1)
+		return RunHeadless(argc, argv);
+
 	// DrawMandelbrot();
 	// DrawSSEMandelbrot();
 	// DrawFloatSSEMandelbrot();
@@ -15,4 +23,7 @@ int main(int argc, char* argv[])
 	DrawSSEAlphaBlending();
 
 	return 0;
+#else
+	return RunHeadless(argc, argv);
+#endif
 }
\ No newline at end of file